@@ -9,119 +9,186 @@
 #define DEBUG_LL
 
 #include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <iterator>
+#include <new>
+#include <ranges>
+#include <type_traits>
+#include <version>
 
 
 template<typename T, typename Allocator = std::allocator<T>>
 class LinkedList;
 
+
+/* tag for the range constructor: the std one where <ranges> has it, so
+ * linkedlist::from_range and std::from_range are the same object */
+namespace linkedlist{
+
+#if defined(__cpp_lib_ranges_to_container)
+    using std::from_range_t;
+    using std::from_range;
+#else
+    struct from_range_t { explicit from_range_t() = default; };
+    inline constexpr from_range_t from_range{};
+#endif
+}
+
 namespace detail{
 
 
+    template<typename R, typename T>
+    concept ContainerCompatibleRange = std::ranges::input_range<R>
+            && std::convertible_to<std::ranges::range_reference_t<R>, T>;
+
+
     template<typename T>
     struct ListNode{
-        T* object_;
         ListNode* next_;
         ListNode* prev_;
     };
 
 
+    /* element node, the value lives in the same allocation as the links.
+     * Every node but the sentinel is one of these, so the value is found
+     * from the node address alone */
+    template<typename T>
+    struct ListValueNode: ListNode<T>{
+        alignas(T) std::byte storage_[sizeof(T)];
+
+        static T* value(ListNode<T>* node) noexcept{
+            return std::launder(reinterpret_cast<T*>(static_cast<ListValueNode*>(node)->storage_));
+        }
+    };
+
+
+    /* allocators with their own destroy must always be called */
+    template<typename Allocator, typename T>
+    concept AllocatorDestroys = requires(Allocator& alloc, T* p){
+        alloc.destroy(p);
+    };
+
+
     template<typename T, typename Allocator>
-    class ConstListIterator: public std::iterator<std::bidirectional_iterator_tag,
-            const T,std::ptrdiff_t, const T*, const T&> {
+    class ConstListIterator {
 
     private:
         ListNode<T>* ptr_;
     public:
 
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
         friend class LinkedList<T, Allocator>;
 
-        explicit ConstListIterator(ListNode<T>* ptr): ptr_(ptr){};
-        explicit ConstListIterator(const ListNode<T>* ptr):
+        constexpr ConstListIterator(): ptr_(nullptr){};
+        constexpr explicit ConstListIterator(ListNode<T>* ptr): ptr_(ptr){};
+        constexpr explicit ConstListIterator(const ListNode<T>* ptr):
         ptr_(const_cast<ListNode<T>*>(ptr)){};
 
-        ConstListIterator& operator ++(){
+        constexpr ConstListIterator& operator ++(){
             ptr_ = ptr_->next_;
             return *this;
         }
 
-        ConstListIterator operator ++(int){
+        constexpr ConstListIterator operator ++(int){
             ConstListIterator ret(ptr_);
             ptr_ = ptr_->next_;
             return ret;
         }
 
-        ConstListIterator& operator --(){
+        constexpr ConstListIterator& operator --(){
             ptr_ = ptr_->prev_;
             return *this;
         }
 
-        ConstListIterator operator --(int){
+        constexpr ConstListIterator operator --(int){
             ConstListIterator ret(ptr_);
             ptr_ = ptr_->prev_;
             return ret;
         }
 
-        bool operator ==(const ConstListIterator& other) const{
+        constexpr bool operator ==(const ConstListIterator& other) const{
             return ptr_ == other.ptr_;
         }
-        bool operator !=(const ConstListIterator& other) const{
+        constexpr bool operator !=(const ConstListIterator& other) const{
             return ptr_ != other.ptr_;
         }
 
         const T& operator *() const{
-            return *ptr_->object_;
+            return *ListValueNode<T>::value(ptr_);
+        }
+
+        const T* operator ->() const{
+            return ListValueNode<T>::value(ptr_);
         }
     };
 
 
     template<typename T, typename Allocator>
-    class ListIterator: public std::iterator<std::bidirectional_iterator_tag,
-            T,std::ptrdiff_t,T*,T&> {
+    class ListIterator {
 
     private:
         ListNode<T>* ptr_;
     public:
 
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
         friend class LinkedList<T, Allocator>;
 
-        explicit ListIterator(ListNode<T>* ptr): ptr_(ptr){};
+        constexpr ListIterator(): ptr_(nullptr){};
+        constexpr explicit ListIterator(ListNode<T>* ptr): ptr_(ptr){};
 
-        ListIterator& operator ++(){
+        constexpr ListIterator& operator ++(){
             ptr_ = ptr_->next_;
             return *this;
         }
 
-        ListIterator operator ++(int){
+        constexpr ListIterator operator ++(int){
             ListIterator ret(ptr_);
             ptr_ = ptr_->next_;
             return ret;
         }
 
-        ListIterator& operator --(){
+        constexpr ListIterator& operator --(){
             ptr_ = ptr_->prev_;
             return *this;
         }
 
-        ListIterator operator --(int){
+        constexpr ListIterator operator --(int){
             ListIterator ret(ptr_);
             ptr_ = ptr_->prev_;
             return ret;
         }
 
-        bool operator ==(const ListIterator& other) const{
+        constexpr bool operator ==(const ListIterator& other) const{
             return ptr_ == other.ptr_;
         }
-        bool operator !=(const ListIterator& other) const{
+        constexpr bool operator !=(const ListIterator& other) const{
             return ptr_ != other.ptr_;
         }
 
-        T& operator *(){
-            return *ptr_->object_;
+        T& operator *() const{
+            return *ListValueNode<T>::value(ptr_);
+        }
+
+        T* operator ->() const{
+            return ListValueNode<T>::value(ptr_);
         }
 
-        operator ConstListIterator<T, Allocator>() const{
+        constexpr operator ConstListIterator<T, Allocator>() const{
             return ConstListIterator<T, Allocator>(ptr_);
         }
     };
@@ -158,9 +225,11 @@ public:
     LinkedList(LinkedList&& other) noexcept;
     LinkedList(size_type count, const T& value);
     explicit LinkedList(size_type count);
-    template<typename InputIt>
+    template<std::input_iterator InputIt>
     LinkedList(InputIt first, InputIt last);
     LinkedList(std::initializer_list<T> init);
+    template<detail::ContainerCompatibleRange<T> R>
+    LinkedList(linkedlist::from_range_t, R&& rg);
     ~LinkedList();
 
 public:
@@ -170,7 +239,7 @@ public:
     LinkedList& operator=(std::initializer_list<T> ilist);
 
     void assign(size_type count, const T& value );
-    template<typename InputIt>
+    template<std::input_iterator InputIt>
     void assign(InputIt first, InputIt last);
     void assign(std::initializer_list<T> ilist);
 
@@ -204,23 +273,54 @@ public:
 
 private:
 
+    using node_type = detail::ListNode<value_type>;
+    using value_node_type = detail::ListValueNode<value_type>;
+    using node_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<value_node_type>;
+
+    /* trivially destructible T needs no destroy call, freeing is enough */
+    static constexpr bool trivial_destroy_ = std::is_trivially_destructible_v<T>
+            && !detail::AllocatorDestroys<Allocator, T>;
+
+    template<typename ...Args>
+    node_type* create_node_(Args&&... args);
+    void destroy_node_(node_type* node) noexcept;
+
+    static void link_chain_(node_type* pos, node_type* first, node_type* last) noexcept;
+    static void unlink_chain_(node_type* first, node_type* last) noexcept;
+
     template<typename U>
     iterator insert_(const_iterator pos, U&& value);
+    template<typename InputIt, typename Sentinel>
+    iterator link_range_(const_iterator pos, InputIt first, Sentinel last);
 
 public:
 
     iterator insert(const_iterator pos, const T& value);
     iterator insert(const_iterator pos, T&& value);
     iterator insert(const_iterator pos, size_type count, const T& value);
-    template<typename InputIt>
+    template<std::input_iterator InputIt>
     iterator insert(const_iterator pos, InputIt first, InputIt last);
     iterator insert(const_iterator pos, std::initializer_list<T> ilist);
 
+    template<detail::ContainerCompatibleRange<T> R>
+    iterator insert_range(const_iterator pos, R&& rg);
+    template<detail::ContainerCompatibleRange<T> R>
+    void append_range(R&& rg);
+    template<detail::ContainerCompatibleRange<T> R>
+    void prepend_range(R&& rg);
+
     void push_front(const T& value);
     void push_front(T&& value);
     void push_back(const T& value);
     void push_back(T&& value);
 
+    template<typename ...Args>
+    iterator emplace(const_iterator pos, Args&&... args);
+    template<typename ...Args>
+    reference emplace_front(Args&&... args);
+    template<typename ...Args>
+    reference emplace_back(Args&&... args);
+
 public:
 
     iterator erase(const_iterator pos);
@@ -229,11 +329,6 @@ public:
     void pop_back();
     void pop_front();
 
-private:
-
-    template<typename Func, typename ...Args>
-    size_type remove_some_elements_(Func, Args&&...);
-
 public:
 
     size_type unique();
@@ -252,8 +347,31 @@ public:
     void sort();
     template<typename Compare>
     void sort(Compare comp);
+    void merge(LinkedList& other);
+    void merge(LinkedList&& other);
+    template<typename Compare>
+    void merge(LinkedList& other, Compare comp);
+    template<typename Compare>
+    void merge(LinkedList&& other, Compare comp);
 
     void reverse() noexcept;
+    void reverse(const_iterator first, const_iterator last) noexcept;
+    iterator rotate(const_iterator first, const_iterator middle, const_iterator last) noexcept;
+
+public:
+
+    void splice(const_iterator pos, LinkedList& other) noexcept;
+    void splice(const_iterator pos, LinkedList&& other) noexcept;
+    void splice(const_iterator pos, LinkedList& other, const_iterator it) noexcept;
+    void splice(const_iterator pos, LinkedList&& other, const_iterator it) noexcept;
+    void splice(const_iterator pos, LinkedList& other, const_iterator first, const_iterator last) noexcept;
+    void splice(const_iterator pos, LinkedList&& other, const_iterator first, const_iterator last) noexcept;
+
+#ifdef DEBUG_LL
+public:
+
+    [[nodiscard]] bool debug_check() const noexcept;
+#endif
 
 private:
 
@@ -263,6 +381,69 @@ private:
 };
 
 
+template<typename T, typename Allocator>
+void swap(LinkedList<T, Allocator>& lhs, LinkedList<T, Allocator>& rhs) noexcept{
+    lhs.swap(rhs);
+}
+
+
+/* node creation and destruction, one allocation per element */
+template<typename T, typename Allocator>
+template<typename ...Args>
+typename LinkedList<T, Allocator>::node_type*
+LinkedList<T, Allocator>::create_node_(Args&&... args) {
+
+    node_allocator_type node_alloc;
+
+    value_node_type* new_node = std::allocator_traits<node_allocator_type>::allocate(node_alloc, 1ull);
+
+    try{
+        Allocator alloc;
+        std::allocator_traits<Allocator>::construct(alloc, reinterpret_cast<T*>(new_node->storage_),
+                                                    std::forward<Args>(args)...);
+    }catch(...){
+        std::allocator_traits<node_allocator_type>::deallocate(node_alloc, new_node, 1ull);
+        throw;
+    }
+
+    return new_node;
+}
+
+
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::destroy_node_(node_type* node) noexcept {
+
+    node_allocator_type node_alloc;
+
+    if constexpr (!trivial_destroy_){
+        Allocator alloc;
+        std::allocator_traits<Allocator>::destroy(alloc, value_node_type::value(node));
+    }
+    std::allocator_traits<node_allocator_type>::deallocate(node_alloc, static_cast<value_node_type*>(node), 1ull);
+}
+
+
+/* link the chain [first, last] before pos */
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::link_chain_(node_type* pos, node_type* first, node_type* last) noexcept {
+
+    auto prev = pos->prev_;
+    prev->next_ = first;
+    first->prev_ = prev;
+    pos->prev_ = last;
+    last->next_ = pos;
+}
+
+
+/* cut the chain [first, last] out, its own outer links are left dangling */
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::unlink_chain_(node_type* first, node_type* last) noexcept {
+
+    first->prev_->next_ = last->next_;
+    last->next_->prev_ = first->prev_;
+}
+
+
 /* insert by universal reference */
 template<typename T, typename Allocator>
 template<typename U>
@@ -271,21 +452,47 @@ LinkedList<T, Allocator>::insert_(LinkedList::const_iterator pos, U &&value) {
 
     static_assert(std::is_same_v<std::decay_t<T>, std::decay_t<U>>);
 
-    Allocator alloc;
-    typename Allocator::template rebind<detail::ListNode<value_type>>::other other_alloc;
+    return emplace(pos, std::forward<U>(value));
+}
 
-    detail::ListNode<value_type>* new_node = std::allocator_traits<decltype(other_alloc)>::allocate(other_alloc, 1ull);
-    new_node->object_ = std::allocator_traits<Allocator>::allocate(alloc, 1ull);
-    std::allocator_traits<Allocator>::construct(alloc, new_node->object_, std::forward<U>(value));
 
-    auto prev = pos.ptr_->prev_;
-    prev->next_ = new_node;
-    new_node->prev_ = prev;
-    pos.ptr_->prev_ = new_node;
-    new_node->next_ = pos.ptr_;
-    ++size_;
+/* bulk insert: the whole range is built as a detached chain and linked
+ * before pos at once, so on exception the list is left untouched */
+template<typename T, typename Allocator>
+template<typename InputIt, typename Sentinel>
+typename LinkedList<T, Allocator>::iterator
+LinkedList<T, Allocator>::link_range_(LinkedList::const_iterator pos, InputIt first, Sentinel last) {
 
-    return iterator(new_node);
+    if(first == last){
+        return iterator(pos.ptr_);
+    }
+
+    node_type* head = create_node_(*first);
+    node_type* tail = head;
+    size_type count = 1;
+
+    try{
+        for(++first; first != last; ++first){
+            node_type* new_node = create_node_(*first);
+            tail->next_ = new_node;
+            new_node->prev_ = tail;
+            tail = new_node;
+            ++count;
+        }
+    }catch(...){
+        while(head != tail){
+            auto next = head->next_;
+            destroy_node_(head);
+            head = next;
+        }
+        destroy_node_(tail);
+        throw;
+    }
+
+    link_chain_(pos.ptr_, head, tail);
+    size_ += count;
+
+    return iterator(head);
 }
 
 
@@ -311,7 +518,7 @@ typename LinkedList<T, Allocator>::iterator
 LinkedList<T, Allocator>::insert(LinkedList::const_iterator pos, LinkedList::size_type count, const T &value) {
 
     if(count==0){
-        return pos;
+        return iterator(pos.ptr_);
     }
 
     auto ret = insert(pos, value);
@@ -324,29 +531,45 @@ LinkedList<T, Allocator>::insert(LinkedList::const_iterator pos, LinkedList::siz
 
 
 template<typename T, typename Allocator>
-template<typename InputIt>
+template<std::input_iterator InputIt>
 typename LinkedList<T, Allocator>::iterator
 LinkedList<T, Allocator>::insert(LinkedList::const_iterator pos, InputIt first, InputIt last) {
 
-    if(first==last){
-        return iterator(pos.ptr_);
-    }
+    return link_range_(pos, first, last);
+}
 
-    auto ret = insert(pos, std::forward<decltype(*first)>(*first));
 
-    for(auto it = ++first; it!=last; ++it){
-        insert(pos, std::forward<decltype(*it)>(*it));
-    }
+template<typename T, typename Allocator>
+typename LinkedList<T, Allocator>::iterator
+LinkedList<T, Allocator>::insert(LinkedList::const_iterator pos, std::initializer_list<T> ilist) {
 
-    return ret;
+    return insert(pos, ilist.begin(), ilist.end());
 }
 
 
+/* range methods */
 template<typename T, typename Allocator>
+template<detail::ContainerCompatibleRange<T> R>
 typename LinkedList<T, Allocator>::iterator
-LinkedList<T, Allocator>::insert(LinkedList::const_iterator pos, std::initializer_list<T> ilist) {
+LinkedList<T, Allocator>::insert_range(LinkedList::const_iterator pos, R &&rg) {
 
-    return insert(pos, ilist.begin(), ilist.end());
+    return link_range_(pos, std::ranges::begin(rg), std::ranges::end(rg));
+}
+
+
+template<typename T, typename Allocator>
+template<detail::ContainerCompatibleRange<T> R>
+void LinkedList<T, Allocator>::append_range(R &&rg) {
+
+    insert_range(cend(), std::forward<R>(rg));
+}
+
+
+template<typename T, typename Allocator>
+template<detail::ContainerCompatibleRange<T> R>
+void LinkedList<T, Allocator>::prepend_range(R &&rg) {
+
+    insert_range(cbegin(), std::forward<R>(rg));
 }
 
 
@@ -374,21 +597,45 @@ void LinkedList<T, Allocator>::push_back(T &&value) {
 }
 
 
-/* erase methods */
+/* emplace methods */
 template<typename T, typename Allocator>
+template<typename ...Args>
 typename LinkedList<T, Allocator>::iterator
-LinkedList<T, Allocator>::erase(LinkedList::const_iterator pos) {
+LinkedList<T, Allocator>::emplace(LinkedList::const_iterator pos, Args&&... args) {
+
+    node_type* new_node = create_node_(std::forward<Args>(args)...);
+    link_chain_(pos.ptr_, new_node, new_node);
+    ++size_;
+
+    return iterator(new_node);
+}
+
+
+template<typename T, typename Allocator>
+template<typename ...Args>
+typename LinkedList<T, Allocator>::reference LinkedList<T, Allocator>::emplace_front(Args&&... args) {
+
+    return *emplace(cbegin(), std::forward<Args>(args)...);
+}
+
+
+template<typename T, typename Allocator>
+template<typename ...Args>
+typename LinkedList<T, Allocator>::reference LinkedList<T, Allocator>::emplace_back(Args&&... args) {
+
+    return *emplace(cend(), std::forward<Args>(args)...);
+}
 
-    Allocator alloc;
-    typename Allocator::template rebind<detail::ListNode<value_type>>::other other_alloc;
 
-    std::allocator_traits<Allocator>::destroy(alloc, pos.ptr_->object_);
-    std::allocator_traits<Allocator>::deallocate(alloc, pos.ptr_->object_, 1ull);
+/* erase methods */
+template<typename T, typename Allocator>
+typename LinkedList<T, Allocator>::iterator
+LinkedList<T, Allocator>::erase(LinkedList::const_iterator pos) {
 
     pos.ptr_->prev_->next_ = pos.ptr_->next_;
     pos.ptr_->next_->prev_ = pos.ptr_->prev_;
     auto ret_ptr = pos.ptr_->next_;
-    std::allocator_traits<decltype(other_alloc)>::deallocate(other_alloc, pos.ptr_, 1ull);
+    destroy_node_(pos.ptr_);
     --size_;
 
     return iterator(ret_ptr);
@@ -399,9 +646,17 @@ template<typename T, typename Allocator>
 typename LinkedList<T, Allocator>::iterator
 LinkedList<T, Allocator>::erase(LinkedList::const_iterator first, LinkedList::const_iterator last) {
 
-    for(auto it = first; it != last;){
-        auto del_it = it++;
-        erase(del_it);
+    if(first == last){
+        return iterator(last.ptr_);
+    }
+
+    /* cut the range out once, then only free the nodes */
+    unlink_chain_(first.ptr_, last.ptr_->prev_);
+    for(auto node = first.ptr_; node != last.ptr_;){
+        auto next = node->next_;
+        destroy_node_(node);
+        --size_;
+        node = next;
     }
 
     return iterator(last.ptr_);
@@ -427,7 +682,6 @@ template<typename T, typename Allocator>
 LinkedList<T, Allocator>::LinkedList():size_(0ull){
     base_.next_ = &base_;
     base_.prev_ = &base_;
-    base_.object_ = nullptr;
 }
 
 template<typename T, typename Allocator>
@@ -445,7 +699,7 @@ LinkedList<T, Allocator>::LinkedList(const LinkedList &other): LinkedList(){
 template<typename T, typename Allocator>
 LinkedList<T, Allocator>::LinkedList(LinkedList &&other) noexcept: LinkedList() {
 
-    std::swap(*this, other);
+    swap(other);
 }
 
 template<typename T, typename Allocator>
@@ -458,12 +712,19 @@ template<typename T, typename Allocator>
 LinkedList<T, Allocator>::LinkedList(LinkedList::size_type count): LinkedList(count, value_type()) {}
 
 template<typename T, typename Allocator>
-template<typename InputIt>
+template<std::input_iterator InputIt>
 LinkedList<T, Allocator>::LinkedList(InputIt first, InputIt last): LinkedList() {
 
     insert(cend(), first, last);
 }
 
+template<typename T, typename Allocator>
+template<detail::ContainerCompatibleRange<T> R>
+LinkedList<T, Allocator>::LinkedList(linkedlist::from_range_t, R &&rg): LinkedList() {
+
+    insert_range(cend(), std::forward<R>(rg));
+}
+
 template<typename T, typename Allocator>
 LinkedList<T, Allocator>::LinkedList(std::initializer_list<T> init): LinkedList() {
 
@@ -488,8 +749,12 @@ LinkedList<T, Allocator>& LinkedList<T, Allocator>::operator=(const LinkedList &
 template<typename T, typename Allocator>
 LinkedList<T, Allocator> &LinkedList<T, Allocator>::operator=(LinkedList &&other)  noexcept {
 
-    erase(cbegin(), cend());
-    std::swap(*this, other);
+    if(this == &other){
+        return *this;
+    }
+
+    clear();
+    swap(other);
 
     return *this;
 }
@@ -524,7 +789,7 @@ void LinkedList<T, Allocator>::assign(LinkedList::size_type count, const T &valu
 
 
 template<typename T, typename Allocator>
-template<typename InputIt>
+template<std::input_iterator InputIt>
 void LinkedList<T, Allocator>::assign(InputIt first, InputIt last) {
 
     clear();
@@ -536,15 +801,15 @@ template<typename T, typename Allocator>
 void LinkedList<T, Allocator>::assign(std::initializer_list<T> ilist) {
 
     auto it = begin();
-    for(size_type i=0; i < std::min(ilist.size(), size_); ++i){
-        *it = ilist[i];
-        ++it;
+    auto src = ilist.begin();
+    for(; it != end() && src != ilist.end(); ++it, ++src){
+        *it = *src;
     }
 
-    if(ilist.size() < size_){
+    if(src == ilist.end()){
         erase(it, end());
     }else{
-        insert(cend(), ilist.begin()+size_, ilist.end());
+        insert(cend(), src, ilist.end());
     }
 }
 
@@ -565,13 +830,13 @@ typename LinkedList<T, Allocator>::const_reference LinkedList<T, Allocator>::fro
 template<typename T, typename Allocator>
 typename LinkedList<T, Allocator>::reference LinkedList<T, Allocator>::back() {
 
-    return *base_.prev_->object_;
+    return *std::prev(end());
 }
 
 template<typename T, typename Allocator>
 typename LinkedList<T, Allocator>::const_reference LinkedList<T, Allocator>::back() const {
 
-    return *base_.prev_->object_;
+    return *std::prev(end());
 }
 
 template<typename T, typename Allocator>
@@ -596,21 +861,26 @@ void LinkedList<T, Allocator>::clear() noexcept {
 template<typename T, typename Allocator>
 void LinkedList<T, Allocator>::resize(LinkedList::size_type count, const value_type &value) {
 
-    assign(count, value);
+    if(count > size_){
+        insert(cend(), count - size_, value);
+        return;
+    }
+
+    while(size_ > count){
+        pop_back();
+    }
 }
 
 
 template<typename T, typename Allocator>
 void LinkedList<T, Allocator>::resize(LinkedList::size_type count) {
 
-    if(count > size_){
-        assign(count, value_type());
+    while(size_ < count){
+        emplace_back();
     }
 
-    if(count < size_){
-        auto it = cbegin();
-        std::advance(it, count);
-        erase(it, cend());
+    while(size_ > count){
+        pop_back();
     }
 }
 
@@ -618,40 +888,185 @@ void LinkedList<T, Allocator>::resize(LinkedList::size_type count) {
 template<typename T, typename Allocator>
 void LinkedList<T, Allocator>::swap(LinkedList &other) noexcept {
 
-    std::swap(*this, other);
+    if(this == &other){
+        return;
+    }
+
+    std::swap(base_.next_, other.base_.next_);
+    std::swap(base_.prev_, other.base_.prev_);
+    std::swap(size_, other.size_);
+
+    /* the end nodes of both chains still point to the old sentinel */
+    for(auto list : {this, &other}){
+        if(list->size_ == 0){
+            list->base_.next_ = &list->base_;
+            list->base_.prev_ = &list->base_;
+        }else{
+            list->base_.next_->prev_ = &list->base_;
+            list->base_.prev_->next_ = &list->base_;
+        }
+    }
 }
 
 
+/* reverse and rotate only relink nodes, elements are never touched
+ * and iterators keep pointing to the same elements */
 template<typename T, typename Allocator>
 void LinkedList<T, Allocator>::reverse() noexcept {
 
-    for(auto it = begin(); it!=end(); --it){
+    reverse(cbegin(), cend());
+}
+
 
-        std::swap(it.ptr_->prev_, it.ptr_->next_);
+/* one pass swapping the links of each node, then the reversed chain
+ * is hooked back between its old neighbours */
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::reverse(LinkedList::const_iterator first, LinkedList::const_iterator last) noexcept {
+
+    if(first == last || first.ptr_->next_ == last.ptr_){
+        return;
     }
 
-    std::swap(base_.prev_, base_.next_);
+    auto before = first.ptr_->prev_;
+    auto tail = last.ptr_->prev_;
+
+    for(auto node = first.ptr_; node != last.ptr_;){
+        auto next = node->next_;
+        std::swap(node->next_, node->prev_);
+        node = next;
+    }
+
+    before->next_ = tail;
+    tail->prev_ = before;
+    first.ptr_->next_ = last.ptr_;
+    last.ptr_->prev_ = first.ptr_;
 }
 
 
-/* remove methods */
+/* [middle, last) is moved in front of first. Like std::rotate, returns
+ * where the element at first ended up, or last if first == middle */
 template<typename T, typename Allocator>
-template<typename Func, typename... Args>
-typename LinkedList<T, Allocator>::size_type
-LinkedList<T, Allocator>::remove_some_elements_(Func f, Args&&... arg) {
+typename LinkedList<T, Allocator>::iterator
+LinkedList<T, Allocator>::rotate(LinkedList::const_iterator first, LinkedList::const_iterator middle,
+                                 LinkedList::const_iterator last) noexcept {
 
-    auto it = f(begin(), end(), std::forward<Args>(arg)...);
-    size_type ret = std::distance(it, end());
-    erase(it, end());
-    return ret;
+    if(first == middle){
+        return iterator(last.ptr_);
+    }
+
+    splice(first, *this, middle, last);
+
+    return iterator(first.ptr_);
 }
 
 
+/* splice methods, nodes are relinked and iterators to them stay valid */
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::splice(LinkedList::const_iterator pos, LinkedList &other) noexcept {
+
+    if(this == &other || other.empty()){
+        return;
+    }
+
+    auto first = other.base_.next_;
+    auto last = other.base_.prev_;
+    unlink_chain_(first, last);
+    link_chain_(pos.ptr_, first, last);
+
+    size_ += other.size_;
+    other.size_ = 0;
+}
+
+
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::splice(LinkedList::const_iterator pos, LinkedList &&other) noexcept {
+
+    splice(pos, other);
+}
+
+
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::splice(LinkedList::const_iterator pos, LinkedList &other,
+                                      LinkedList::const_iterator it) noexcept {
+
+    if(pos.ptr_ == it.ptr_ || pos.ptr_ == it.ptr_->next_){
+        return;
+    }
+
+    unlink_chain_(it.ptr_, it.ptr_);
+    link_chain_(pos.ptr_, it.ptr_, it.ptr_);
+
+    ++size_;
+    --other.size_;
+}
+
+
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::splice(LinkedList::const_iterator pos, LinkedList &&other,
+                                      LinkedList::const_iterator it) noexcept {
+
+    splice(pos, other, it);
+}
+
+
+/* O(1) within the same list, linear in the range length otherwise */
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::splice(LinkedList::const_iterator pos, LinkedList &other,
+                                      LinkedList::const_iterator first, LinkedList::const_iterator last) noexcept {
+
+    if(first == last || pos == first || pos == last){
+        return;
+    }
+
+    if(this != &other){
+        auto count = static_cast<size_type>(std::distance(first, last));
+        size_ += count;
+        other.size_ -= count;
+    }
+
+    auto tail = last.ptr_->prev_;
+    unlink_chain_(first.ptr_, tail);
+    link_chain_(pos.ptr_, first.ptr_, tail);
+}
+
+
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::splice(LinkedList::const_iterator pos, LinkedList &&other,
+                                      LinkedList::const_iterator first, LinkedList::const_iterator last) noexcept {
+
+    splice(pos, other, first, last);
+}
+
+
+/* remove methods, only the removed nodes are unlinked, iterators
+ * to the remaining elements stay valid */
 template<typename T, typename Allocator>
 typename LinkedList<T, Allocator>::size_type
 LinkedList<T, Allocator>::remove(const T &value) {
 
-    return remove_some_elements_(std::remove<iterator, const_value_type>, value);
+    size_type ret = 0;
+    auto deferred = end();
+
+    for(auto it = begin(); it != end();){
+        if(*it == value){
+            /* value may live in this very list, erase its node last */
+            if(std::addressof(*it) == std::addressof(value)){
+                deferred = it++;
+                continue;
+            }
+            it = erase(it);
+            ++ret;
+        }else{
+            ++it;
+        }
+    }
+
+    if(deferred != end()){
+        erase(deferred);
+        ++ret;
+    }
+
+    return ret;
 }
 
 
@@ -660,7 +1075,17 @@ template<typename UnaryPredicate>
 typename LinkedList<T, Allocator>::size_type
 LinkedList<T, Allocator>::remove_if(UnaryPredicate p) {
 
-    return remove_some_elements_(std::remove_if<iterator, UnaryPredicate>, p);
+    size_type ret = 0;
+    for(auto it = begin(); it != end();){
+        if(p(*it)){
+            it = erase(it);
+            ++ret;
+        }else{
+            ++it;
+        }
+    }
+
+    return ret;
 }
 
 
@@ -668,7 +1093,7 @@ template<typename T, typename Allocator>
 typename LinkedList<T, Allocator>::size_type
 LinkedList<T, Allocator>::unique() {
 
-    return remove_some_elements_(std::unique<iterator>);
+    return unique(std::equal_to<>());
 }
 
 
@@ -677,8 +1102,144 @@ template<typename BinaryPredicate>
 typename LinkedList<T, Allocator>::size_type
 LinkedList<T, Allocator>::unique(BinaryPredicate p) {
 
-    return remove_some_elements_(std::unique<iterator, BinaryPredicate>, p);
+    if(size_ < 2){
+        return 0;
+    }
+
+    size_type ret = 0;
+    auto prev = begin();
+    for(auto it = std::next(prev); it != end();){
+        if(p(*prev, *it)){
+            it = erase(it);
+            ++ret;
+        }else{
+            prev = it++;
+        }
+    }
+
+    return ret;
+}
+
+
+/* merge and sort methods, both stable and done by relinking nodes */
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::merge(LinkedList &other) {
+
+    merge(other, std::less<>());
+}
+
+
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::merge(LinkedList &&other) {
+
+    merge(other, std::less<>());
+}
+
+
+template<typename T, typename Allocator>
+template<typename Compare>
+void LinkedList<T, Allocator>::merge(LinkedList &other, Compare comp) {
+
+    if(this == &other){
+        return;
+    }
+
+    auto it = cbegin();
+    while(!other.empty()){
+        auto first = other.cbegin();
+        while(it != cend() && !comp(*first, *it)){
+            ++it;
+        }
+        if(it == cend()){
+            splice(it, other);
+            return;
+        }
+        splice(it, other, first);
+    }
+}
+
+
+template<typename T, typename Allocator>
+template<typename Compare>
+void LinkedList<T, Allocator>::merge(LinkedList &&other, Compare comp) {
+
+    merge(other, comp);
+}
+
+
+template<typename T, typename Allocator>
+void LinkedList<T, Allocator>::sort() {
+
+    sort(std::less<>());
+}
+
+
+/* bottom-up merge sort: bucket i holds a sorted run of 2^i nodes.
+ * If comp throws every node is spliced back, in unspecified order */
+template<typename T, typename Allocator>
+template<typename Compare>
+void LinkedList<T, Allocator>::sort(Compare comp) {
+
+    if(size_ < 2){
+        return;
+    }
+
+    LinkedList carry;
+    LinkedList buckets[64];
+    size_type filled = 0;
+
+    try{
+        while(!empty()){
+            carry.splice(carry.cbegin(), *this, cbegin());
+
+            size_type i = 0;
+            for(; i < filled && !buckets[i].empty(); ++i){
+                buckets[i].merge(carry, comp);
+                carry.swap(buckets[i]);
+            }
+            carry.swap(buckets[i]);
+            if(i == filled){
+                ++filled;
+            }
+        }
+
+        for(size_type i=1; i<filled; ++i){
+            buckets[i].merge(buckets[i - 1], comp);
+        }
+    }catch(...){
+        splice(cend(), carry);
+        for(auto &bucket : buckets){
+            splice(cend(), bucket);
+        }
+        throw;
+    }
+
+    swap(buckets[filled - 1]);
+}
+
+
+#ifdef DEBUG_LL
+/* walks the ring both ways and checks links and size, for tests and fuzzing */
+template<typename T, typename Allocator>
+bool LinkedList<T, Allocator>::debug_check() const noexcept {
+
+    size_type count = 0;
+    for(auto node = &base_; node->next_ != &base_; node = node->next_){
+        if(node->next_ == nullptr || node->next_->prev_ != node || ++count > size_){
+            return false;
+        }
+    }
+
+    size_type back_count = 0;
+    for(auto node = &base_; node->prev_ != &base_; node = node->prev_){
+        if(node->prev_ == nullptr || node->prev_->next_ != node || ++back_count > size_){
+            return false;
+        }
+    }
+
+    return count == size_ && back_count == size_;
 }
+#endif
 
 
 /* iterators */
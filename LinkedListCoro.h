@@ -0,0 +1,512 @@
+#ifndef LINKEDLIST_LINKEDLISTCORO_H
+#define LINKEDLIST_LINKEDLISTCORO_H
+
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "LinkedList.h"
+
+
+/* Lazy single-pass generator, channel with back-pressure and list adaptors.
+ * Requires C++20. */
+
+template<typename T>
+class Generator;
+
+namespace detail{
+
+
+    template<typename T>
+    class GeneratorIterator {
+
+    private:
+        using handle_type = std::coroutine_handle<typename Generator<T>::promise_type>;
+        handle_type handle_;
+    public:
+
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::remove_cv_t<std::remove_reference_t<T>>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::remove_reference_t<T>*;
+        using reference = std::remove_reference_t<T>&;
+
+        GeneratorIterator(): handle_(nullptr){};
+        explicit GeneratorIterator(handle_type handle): handle_(handle){};
+
+        GeneratorIterator& operator ++(){
+            handle_.resume();
+            if(handle_.done()){
+                auto h = std::exchange(handle_, nullptr);
+                h.promise().rethrow_if_failed();
+            }
+            return *this;
+        }
+
+        void operator ++(int){
+            ++*this;
+        }
+
+        bool operator ==(const GeneratorIterator& other) const{
+            return handle_ == other.handle_;
+        }
+        bool operator !=(const GeneratorIterator& other) const{
+            return handle_ != other.handle_;
+        }
+
+        reference operator *() const{
+            return *handle_.promise().value_;
+        }
+
+        pointer operator ->() const{
+            return handle_.promise().value_;
+        }
+    };
+}
+
+
+template<typename T>
+class Generator {
+
+public:
+
+    using value_type = std::remove_cv_t<std::remove_reference_t<T>>;
+    using reference = std::remove_reference_t<T>&;
+    using pointer = std::remove_reference_t<T>*;
+
+    struct promise_type {
+
+        pointer value_ = nullptr;
+        std::exception_ptr exception_;
+
+        Generator get_return_object() noexcept{
+            return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() const noexcept{ return {}; }
+        std::suspend_always final_suspend() const noexcept{ return {}; }
+
+        /* the yielded object lives in the coroutine frame until the next resume */
+        std::suspend_always yield_value(std::remove_reference_t<T>& value) noexcept{
+            value_ = std::addressof(value);
+            return {};
+        }
+        std::suspend_always yield_value(std::remove_reference_t<T>&& value) noexcept{
+            value_ = std::addressof(value);
+            return {};
+        }
+
+        void return_void() const noexcept{}
+
+        void unhandled_exception() noexcept{
+            exception_ = std::current_exception();
+        }
+
+        void rethrow_if_failed() const{
+            if(exception_){
+                std::rethrow_exception(exception_);
+            }
+        }
+
+        /* disallow co_await inside generators */
+        template<typename U>
+        std::suspend_never await_transform(U&&) = delete;
+    };
+
+    using iterator = detail::GeneratorIterator<T>;
+
+public:
+
+    Generator() = default;
+    Generator(const Generator&) = delete;
+    Generator(Generator&& other) noexcept: handle_(std::exchange(other.handle_, nullptr)){};
+    ~Generator();
+
+    Generator& operator=(const Generator&) = delete;
+    Generator& operator=(Generator&& other) noexcept;
+
+public:
+
+    iterator begin();
+    iterator end() noexcept;
+
+private:
+
+    explicit Generator(std::coroutine_handle<promise_type> handle): handle_(handle){};
+
+    std::coroutine_handle<promise_type> handle_{};
+
+};
+
+
+template<typename T>
+Generator<T>::~Generator() {
+
+    if(handle_){
+        handle_.destroy();
+    }
+}
+
+
+template<typename T>
+Generator<T>& Generator<T>::operator=(Generator &&other) noexcept {
+
+    if(this != &other){
+        if(handle_){
+            handle_.destroy();
+        }
+        handle_ = std::exchange(other.handle_, nullptr);
+    }
+
+    return *this;
+}
+
+
+/* begin() starts the coroutine, so a generator can be iterated only once */
+template<typename T>
+typename Generator<T>::iterator Generator<T>::begin() {
+
+    if(!handle_){
+        return end();
+    }
+
+    handle_.resume();
+    if(handle_.done()){
+        handle_.promise().rethrow_if_failed();
+        return end();
+    }
+
+    return iterator(handle_);
+}
+
+
+template<typename T>
+typename Generator<T>::iterator Generator<T>::end() noexcept {
+
+    return iterator();
+}
+
+
+/* lazy views over a list; the list must outlive the generator */
+template<typename T, typename Allocator>
+Generator<T> lazy_view(LinkedList<T, Allocator>& list){
+
+    for(auto &i : list){
+        co_yield i;
+    }
+}
+
+
+template<typename T, typename Allocator>
+Generator<const T> lazy_view(const LinkedList<T, Allocator>& list){
+
+    for(auto &i : list){
+        co_yield i;
+    }
+}
+
+
+template<typename T, typename UnaryPredicate>
+Generator<T> lazy_filter(Generator<T> source, UnaryPredicate p){
+
+    for(auto &i : source){
+        if(p(i)){
+            co_yield i;
+        }
+    }
+}
+
+
+template<typename T, typename UnaryFunction,
+        typename R = std::invoke_result_t<UnaryFunction&, std::remove_reference_t<T>&>>
+Generator<std::remove_cvref_t<R>> lazy_transform(Generator<T> source, UnaryFunction f){
+
+    for(auto &i : source){
+        co_yield f(i);
+    }
+}
+
+
+/* drain a generator straight into a list, no intermediate buffer */
+template<typename T, typename Allocator, typename U>
+void append(LinkedList<T, Allocator>& list, Generator<U> source){
+
+    for(auto &i : source){
+        list.push_back(i);
+    }
+}
+
+
+template<typename T, typename Allocator = std::allocator<std::remove_cv_t<T>>>
+LinkedList<std::remove_cv_t<T>, Allocator> to_list(Generator<T> source){
+
+    return LinkedList<std::remove_cv_t<T>, Allocator>(source.begin(), source.end());
+}
+
+
+
+/* Bounded single-threaded channel for event-loop code. Producers
+ * co_await push_back() and are suspended while the buffer is full,
+ * consumers co_await pop_front() and are suspended while it is empty.
+ * Waiters are resumed inline by the counterpart, no thread is ever blocked.
+ * Not thread-safe: all coroutines must run on the same executor. */
+template<typename T, typename Allocator = std::allocator<T>>
+class AsyncChannel {
+
+public:
+
+    using value_type = T;
+    using size_type = std::size_t;
+
+private:
+
+    struct PushAwaiter;
+    struct PopAwaiter;
+
+    using push_waiter_alloc = typename std::allocator_traits<Allocator>::template rebind_alloc<PushAwaiter*>;
+    using pop_waiter_alloc = typename std::allocator_traits<Allocator>::template rebind_alloc<PopAwaiter*>;
+
+    struct PushAwaiter {
+        AsyncChannel& channel_;
+        T value_;
+        std::coroutine_handle<> handle_{};
+        bool accepted_ = false;
+
+        bool await_ready(){
+            accepted_ = channel_.try_push_(value_);
+            return accepted_ || channel_.closed_;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle){
+            handle_ = handle;
+            channel_.push_waiters_.push_back(this);
+        }
+
+        /* false if the channel was closed before the value got in */
+        bool await_resume() const noexcept{
+            return accepted_;
+        }
+    };
+
+    struct PopAwaiter {
+        AsyncChannel& channel_;
+        std::optional<T> value_{};
+        std::coroutine_handle<> handle_{};
+
+        bool await_ready(){
+            value_ = channel_.try_pop_();
+            return value_.has_value() || channel_.closed_;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle){
+            handle_ = handle;
+            channel_.pop_waiters_.push_back(this);
+        }
+
+        /* empty optional once the channel is closed and drained */
+        std::optional<T> await_resume(){
+            return std::move(value_);
+        }
+    };
+
+public:
+
+    explicit AsyncChannel(size_type capacity): capacity_(capacity){};
+    AsyncChannel(const AsyncChannel&) = delete;
+    AsyncChannel& operator=(const AsyncChannel&) = delete;
+    ~AsyncChannel();
+
+public:
+
+    [[nodiscard]] PushAwaiter push_back(const T& value);
+    [[nodiscard]] PushAwaiter push_back(T&& value);
+    [[nodiscard]] PopAwaiter pop_front();
+
+    bool try_push_back(const T& value);
+    bool try_push_back(T&& value);
+    std::optional<T> try_pop_front();
+
+    void close();
+
+public:
+
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+    [[nodiscard]] bool empty() const;
+    [[nodiscard]] bool closed() const noexcept;
+
+private:
+
+    bool try_push_(T& value);
+    std::optional<T> try_pop_();
+
+private:
+
+    LinkedList<T, Allocator> buffer_;
+    LinkedList<PushAwaiter*, push_waiter_alloc> push_waiters_;
+    LinkedList<PopAwaiter*, pop_waiter_alloc> pop_waiters_;
+    size_type capacity_;
+    bool closed_ = false;
+
+};
+
+
+template<typename T, typename Allocator>
+AsyncChannel<T, Allocator>::~AsyncChannel() {
+
+    close();
+}
+
+
+/* hand the value to a waiting consumer or buffer it if there is room */
+template<typename T, typename Allocator>
+bool AsyncChannel<T, Allocator>::try_push_(T &value) {
+
+    if(closed_){
+        return false;
+    }
+
+    if(!pop_waiters_.empty()){
+        auto waiter = pop_waiters_.front();
+        pop_waiters_.pop_front();
+        waiter->value_.emplace(std::move(value));
+        waiter->handle_.resume();
+        return true;
+    }
+
+    if(buffer_.size() < capacity_){
+        buffer_.push_back(std::move(value));
+        return true;
+    }
+
+    return false;
+}
+
+
+/* take the head of the buffer and let one suspended producer refill it */
+template<typename T, typename Allocator>
+std::optional<T> AsyncChannel<T, Allocator>::try_pop_() {
+
+    std::optional<T> ret;
+
+    if(!buffer_.empty()){
+        ret.emplace(std::move(buffer_.front()));
+        buffer_.pop_front();
+    }
+
+    if(!push_waiters_.empty() && buffer_.size() < capacity_ + (ret ? 0 : 1)){
+        auto waiter = push_waiters_.front();
+        push_waiters_.pop_front();
+        if(ret){
+            buffer_.push_back(std::move(waiter->value_));
+        }else{
+            ret.emplace(std::move(waiter->value_));
+        }
+        waiter->accepted_ = true;
+        waiter->handle_.resume();
+    }
+
+    return ret;
+}
+
+
+template<typename T, typename Allocator>
+typename AsyncChannel<T, Allocator>::PushAwaiter AsyncChannel<T, Allocator>::push_back(const T &value) {
+
+    return PushAwaiter{*this, value};
+}
+
+
+template<typename T, typename Allocator>
+typename AsyncChannel<T, Allocator>::PushAwaiter AsyncChannel<T, Allocator>::push_back(T &&value) {
+
+    return PushAwaiter{*this, std::move(value)};
+}
+
+
+template<typename T, typename Allocator>
+typename AsyncChannel<T, Allocator>::PopAwaiter AsyncChannel<T, Allocator>::pop_front() {
+
+    return PopAwaiter{*this};
+}
+
+
+template<typename T, typename Allocator>
+bool AsyncChannel<T, Allocator>::try_push_back(const T &value) {
+
+    T copy(value);
+    return try_push_(copy);
+}
+
+
+template<typename T, typename Allocator>
+bool AsyncChannel<T, Allocator>::try_push_back(T &&value) {
+
+    return try_push_(value);
+}
+
+
+template<typename T, typename Allocator>
+std::optional<T> AsyncChannel<T, Allocator>::try_pop_front() {
+
+    return try_pop_();
+}
+
+
+/* wake everybody: producers get false, consumers drain the buffer then get nullopt */
+template<typename T, typename Allocator>
+void AsyncChannel<T, Allocator>::close() {
+
+    if(closed_){
+        return;
+    }
+    closed_ = true;
+
+    while(!push_waiters_.empty()){
+        auto waiter = push_waiters_.front();
+        push_waiters_.pop_front();
+        waiter->handle_.resume();
+    }
+
+    while(!pop_waiters_.empty()){
+        auto waiter = pop_waiters_.front();
+        pop_waiters_.pop_front();
+        waiter->handle_.resume();
+    }
+}
+
+
+template<typename T, typename Allocator>
+typename AsyncChannel<T, Allocator>::size_type AsyncChannel<T, Allocator>::size() const noexcept {
+
+    return buffer_.size();
+}
+
+
+template<typename T, typename Allocator>
+typename AsyncChannel<T, Allocator>::size_type AsyncChannel<T, Allocator>::capacity() const noexcept {
+
+    return capacity_;
+}
+
+
+template<typename T, typename Allocator>
+bool AsyncChannel<T, Allocator>::empty() const {
+
+    return buffer_.empty();
+}
+
+
+template<typename T, typename Allocator>
+bool AsyncChannel<T, Allocator>::closed() const noexcept {
+
+    return closed_;
+}
+
+
+#endif //LINKEDLIST_LINKEDLISTCORO_H
@@ -0,0 +1,693 @@
+#ifndef LINKEDLIST_LRUCACHE_H
+#define LINKEDLIST_LRUCACHE_H
+
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+#include "LinkedList.h"
+
+
+/* Bounded caches on top of LinkedList. Recency and frequency order is kept
+ * by relinking nodes with splice, so get/put/evict are O(1) and an entry
+ * never moves in memory while it is cached. Capacity is measured by the
+ * Weigher: one unit per entry by default, bytes or any other cost if a
+ * custom weigher is given. */
+
+namespace detail{
+
+
+    struct UnitWeigher {
+        template<typename K, typename V>
+        std::size_t operator ()(const K&, const V&) const noexcept{
+            return 1;
+        }
+    };
+
+
+    template<typename K, typename V>
+    struct CacheEntry {
+        K key_;
+        V value_;
+        std::size_t weight_;
+
+        CacheEntry(const K& key, V&& value, std::size_t weight):
+        key_(key), value_(std::move(value)), weight_(weight){};
+    };
+}
+
+
+
+template<typename K, typename V, typename Weigher = detail::UnitWeigher,
+        typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class LruCache {
+
+public:
+
+    using key_type = K;
+    using mapped_type = V;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using eviction_callback = std::function<void(const K&, V&)>;
+
+private:
+
+    using entry_type = detail::CacheEntry<K, V>;
+    using entry_iterator = typename LinkedList<entry_type>::iterator;
+
+public:
+
+    explicit LruCache(size_type capacity, Weigher weigher = Weigher());
+    LruCache(const LruCache&) = delete;
+    LruCache& operator=(const LruCache&) = delete;
+
+public:
+
+    /* pointer stays valid until the entry is evicted or erased */
+    V* get(const K& key);
+    const V* peek(const K& key) const;
+    [[nodiscard]] bool contains(const K& key) const;
+
+    void put(const K& key, V value);
+    bool erase(const K& key);
+    void clear() noexcept;
+
+    void set_eviction_callback(eviction_callback callback);
+
+public:
+
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] size_type weight() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+
+private:
+
+    void evict_(size_type incoming);
+
+private:
+
+    LinkedList<entry_type> entries_;
+    std::unordered_map<K, entry_iterator, Hash, KeyEqual> index_;
+    eviction_callback on_evict_;
+    Weigher weigher_;
+    size_type capacity_;
+    size_type weight_{};
+
+};
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+LruCache<K, V, Weigher, Hash, KeyEqual>::LruCache(size_type capacity, Weigher weigher):
+weigher_(std::move(weigher)), capacity_(capacity){}
+
+
+/* a hit is moved to the front by relinking its node */
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+V* LruCache<K, V, Weigher, Hash, KeyEqual>::get(const K &key) {
+
+    auto found = index_.find(key);
+    if(found == index_.end()){
+        return nullptr;
+    }
+
+    entries_.splice(entries_.cbegin(), entries_, found->second);
+    return &found->second->value_;
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+const V* LruCache<K, V, Weigher, Hash, KeyEqual>::peek(const K &key) const {
+
+    auto found = index_.find(key);
+    return found == index_.end() ? nullptr : &found->second->value_;
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+bool LruCache<K, V, Weigher, Hash, KeyEqual>::contains(const K &key) const {
+
+    return index_.find(key) != index_.end();
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+void LruCache<K, V, Weigher, Hash, KeyEqual>::put(const K &key, V value) {
+
+    size_type new_weight = weigher_(key, value);
+
+    auto found = index_.find(key);
+    if(found != index_.end()){
+        auto it = found->second;
+        it->value_ = std::move(value);
+        weight_ = weight_ - it->weight_ + new_weight;
+        it->weight_ = new_weight;
+        entries_.splice(entries_.cbegin(), entries_, it);
+    }else{
+        evict_(new_weight);
+        entries_.emplace_front(key, std::move(value), new_weight);
+        try{
+            index_.emplace(key, entries_.begin());
+        }catch(...){
+            entries_.pop_front();
+            throw;
+        }
+        weight_ += new_weight;
+    }
+
+    evict_(0);
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+bool LruCache<K, V, Weigher, Hash, KeyEqual>::erase(const K &key) {
+
+    auto found = index_.find(key);
+    if(found == index_.end()){
+        return false;
+    }
+
+    auto it = found->second;
+    weight_ -= it->weight_;
+    index_.erase(found);
+    entries_.erase(it);
+
+    return true;
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+void LruCache<K, V, Weigher, Hash, KeyEqual>::clear() noexcept {
+
+    index_.clear();
+    entries_.clear();
+    weight_ = 0;
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+void LruCache<K, V, Weigher, Hash, KeyEqual>::set_eviction_callback(eviction_callback callback) {
+
+    on_evict_ = std::move(callback);
+}
+
+
+/* drop least recently used entries from the back until incoming weight fits */
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+void LruCache<K, V, Weigher, Hash, KeyEqual>::evict_(size_type incoming) {
+
+    while(weight_ + incoming > capacity_ && !entries_.empty()){
+        auto &victim = entries_.back();
+        index_.erase(victim.key_);
+        weight_ -= victim.weight_;
+        if(on_evict_){
+            on_evict_(victim.key_, victim.value_);
+        }
+        entries_.pop_back();
+    }
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+typename LruCache<K, V, Weigher, Hash, KeyEqual>::size_type
+LruCache<K, V, Weigher, Hash, KeyEqual>::size() const noexcept {
+
+    return entries_.size();
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+typename LruCache<K, V, Weigher, Hash, KeyEqual>::size_type
+LruCache<K, V, Weigher, Hash, KeyEqual>::weight() const noexcept {
+
+    return weight_;
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+typename LruCache<K, V, Weigher, Hash, KeyEqual>::size_type
+LruCache<K, V, Weigher, Hash, KeyEqual>::capacity() const noexcept {
+
+    return capacity_;
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+bool LruCache<K, V, Weigher, Hash, KeyEqual>::empty() const noexcept {
+
+    return entries_.empty();
+}
+
+
+
+/* LFU with O(1) operations: a list of frequency buckets in ascending order,
+ * each holding its entries in recency order. A hit relinks the entry into
+ * the next bucket, ties on frequency are evicted least recently used first. */
+template<typename K, typename V, typename Weigher = detail::UnitWeigher,
+        typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class LfuCache {
+
+public:
+
+    using key_type = K;
+    using mapped_type = V;
+    using size_type = std::size_t;
+    using hasher = Hash;
+    using eviction_callback = std::function<void(const K&, V&)>;
+
+private:
+
+    using entry_type = detail::CacheEntry<K, V>;
+    using entry_iterator = typename LinkedList<entry_type>::iterator;
+
+    struct Bucket {
+        size_type frequency_;
+        LinkedList<entry_type> entries_;
+
+        explicit Bucket(size_type frequency): frequency_(frequency){};
+    };
+
+    using bucket_iterator = typename LinkedList<Bucket>::iterator;
+
+    struct Position {
+        bucket_iterator bucket_;
+        entry_iterator entry_;
+    };
+
+public:
+
+    explicit LfuCache(size_type capacity, Weigher weigher = Weigher());
+    LfuCache(const LfuCache&) = delete;
+    LfuCache& operator=(const LfuCache&) = delete;
+
+public:
+
+    /* pointer stays valid until the entry is evicted or erased */
+    V* get(const K& key);
+    const V* peek(const K& key) const;
+    [[nodiscard]] bool contains(const K& key) const;
+    [[nodiscard]] size_type frequency(const K& key) const;
+
+    void put(const K& key, V value);
+    bool erase(const K& key);
+    void clear() noexcept;
+
+    void set_eviction_callback(eviction_callback callback);
+
+public:
+
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] size_type weight() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+
+private:
+
+    void touch_(Position& pos);
+    void evict_(size_type incoming);
+
+private:
+
+    LinkedList<Bucket> buckets_;
+    std::unordered_map<K, Position, Hash, KeyEqual> index_;
+    eviction_callback on_evict_;
+    Weigher weigher_;
+    size_type capacity_;
+    size_type weight_{};
+
+};
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+LfuCache<K, V, Weigher, Hash, KeyEqual>::LfuCache(size_type capacity, Weigher weigher):
+weigher_(std::move(weigher)), capacity_(capacity){}
+
+
+/* move the entry node into the bucket of frequency + 1 */
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+void LfuCache<K, V, Weigher, Hash, KeyEqual>::touch_(Position &pos) {
+
+    auto current = pos.bucket_;
+    auto next = std::next(current);
+
+    if(next == buckets_.end() || next->frequency_ != current->frequency_ + 1){
+        next = buckets_.emplace(next, current->frequency_ + 1);
+    }
+
+    next->entries_.splice(next->entries_.cbegin(), current->entries_, pos.entry_);
+    pos.bucket_ = next;
+
+    if(current->entries_.empty()){
+        buckets_.erase(current);
+    }
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+V* LfuCache<K, V, Weigher, Hash, KeyEqual>::get(const K &key) {
+
+    auto found = index_.find(key);
+    if(found == index_.end()){
+        return nullptr;
+    }
+
+    touch_(found->second);
+    return &found->second.entry_->value_;
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+const V* LfuCache<K, V, Weigher, Hash, KeyEqual>::peek(const K &key) const {
+
+    auto found = index_.find(key);
+    return found == index_.end() ? nullptr : &found->second.entry_->value_;
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+bool LfuCache<K, V, Weigher, Hash, KeyEqual>::contains(const K &key) const {
+
+    return index_.find(key) != index_.end();
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+typename LfuCache<K, V, Weigher, Hash, KeyEqual>::size_type
+LfuCache<K, V, Weigher, Hash, KeyEqual>::frequency(const K &key) const {
+
+    auto found = index_.find(key);
+    return found == index_.end() ? 0 : found->second.bucket_->frequency_;
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+void LfuCache<K, V, Weigher, Hash, KeyEqual>::put(const K &key, V value) {
+
+    size_type new_weight = weigher_(key, value);
+
+    auto found = index_.find(key);
+    if(found != index_.end()){
+        auto it = found->second.entry_;
+        it->value_ = std::move(value);
+        weight_ = weight_ - it->weight_ + new_weight;
+        it->weight_ = new_weight;
+        touch_(found->second);
+    }else{
+        evict_(new_weight);
+        if(buckets_.empty() || buckets_.front().frequency_ != 1){
+            buckets_.emplace_front(1);
+        }
+        auto bucket = buckets_.begin();
+        bucket->entries_.emplace_front(key, std::move(value), new_weight);
+        try{
+            index_.emplace(key, Position{bucket, bucket->entries_.begin()});
+        }catch(...){
+            bucket->entries_.pop_front();
+            if(bucket->entries_.empty()){
+                buckets_.erase(bucket);
+            }
+            throw;
+        }
+        weight_ += new_weight;
+    }
+
+    evict_(0);
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+bool LfuCache<K, V, Weigher, Hash, KeyEqual>::erase(const K &key) {
+
+    auto found = index_.find(key);
+    if(found == index_.end()){
+        return false;
+    }
+
+    auto pos = found->second;
+    weight_ -= pos.entry_->weight_;
+    index_.erase(found);
+    pos.bucket_->entries_.erase(pos.entry_);
+    if(pos.bucket_->entries_.empty()){
+        buckets_.erase(pos.bucket_);
+    }
+
+    return true;
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+void LfuCache<K, V, Weigher, Hash, KeyEqual>::clear() noexcept {
+
+    index_.clear();
+    buckets_.clear();
+    weight_ = 0;
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+void LfuCache<K, V, Weigher, Hash, KeyEqual>::set_eviction_callback(eviction_callback callback) {
+
+    on_evict_ = std::move(callback);
+}
+
+
+/* drop the least recently used entry of the lowest frequency until incoming weight fits */
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+void LfuCache<K, V, Weigher, Hash, KeyEqual>::evict_(size_type incoming) {
+
+    while(weight_ + incoming > capacity_ && !buckets_.empty()){
+        auto bucket = buckets_.begin();
+        auto &victim = bucket->entries_.back();
+        index_.erase(victim.key_);
+        weight_ -= victim.weight_;
+        if(on_evict_){
+            on_evict_(victim.key_, victim.value_);
+        }
+        bucket->entries_.pop_back();
+        if(bucket->entries_.empty()){
+            buckets_.erase(bucket);
+        }
+    }
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+typename LfuCache<K, V, Weigher, Hash, KeyEqual>::size_type
+LfuCache<K, V, Weigher, Hash, KeyEqual>::size() const noexcept {
+
+    return index_.size();
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+typename LfuCache<K, V, Weigher, Hash, KeyEqual>::size_type
+LfuCache<K, V, Weigher, Hash, KeyEqual>::weight() const noexcept {
+
+    return weight_;
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+typename LfuCache<K, V, Weigher, Hash, KeyEqual>::size_type
+LfuCache<K, V, Weigher, Hash, KeyEqual>::capacity() const noexcept {
+
+    return capacity_;
+}
+
+
+template<typename K, typename V, typename Weigher, typename Hash, typename KeyEqual>
+bool LfuCache<K, V, Weigher, Hash, KeyEqual>::empty() const noexcept {
+
+    return index_.empty();
+}
+
+
+
+/* Concurrent wrapper: keys are spread over independently locked shards,
+ * each one an LruCache or LfuCache with its share of the capacity.
+ * Values are returned by copy since a pointer would outlive the lock.
+ * Eviction callbacks run under the lock of their shard. */
+template<typename Cache>
+class ShardedCache {
+
+public:
+
+    using key_type = typename Cache::key_type;
+    using mapped_type = typename Cache::mapped_type;
+    using size_type = typename Cache::size_type;
+    using hasher = typename Cache::hasher;
+    using eviction_callback = typename Cache::eviction_callback;
+
+private:
+
+    struct Shard {
+        std::mutex mutex_;
+        Cache cache_;
+
+        template<typename ...Args>
+        explicit Shard(Args&&... args): cache_(std::forward<Args>(args)...){};
+    };
+
+public:
+
+    template<typename ...Args>
+    ShardedCache(size_type shards, size_type capacity, Args&&... args);
+    ShardedCache(const ShardedCache&) = delete;
+    ShardedCache& operator=(const ShardedCache&) = delete;
+
+public:
+
+    std::optional<mapped_type> get(const key_type& key);
+    [[nodiscard]] bool contains(const key_type& key);
+
+    void put(const key_type& key, mapped_type value);
+    bool erase(const key_type& key);
+    void clear();
+
+    void set_eviction_callback(const eviction_callback& callback);
+
+public:
+
+    [[nodiscard]] size_type size();
+    [[nodiscard]] size_type capacity() const noexcept;
+    [[nodiscard]] size_type shard_count() const noexcept;
+
+private:
+
+    Shard& shard_for_(const key_type& key);
+
+private:
+
+    std::deque<Shard> shards_;
+    hasher hash_;
+
+};
+
+
+/* capacity is split exactly: every shard gets the floor, the first
+ * capacity % shards get one more. There are never more shards than units
+ * of capacity, so no shard is created with nothing to hold. */
+template<typename Cache>
+template<typename ...Args>
+ShardedCache<Cache>::ShardedCache(size_type shards, size_type capacity, Args&&... args) {
+
+    shards = std::clamp<size_type>(shards, 1, std::max<size_type>(capacity, 1));
+    size_type per_shard = capacity / shards;
+    size_type remainder = capacity % shards;
+
+    for(size_type i=0; i<shards; ++i){
+        shards_.emplace_back(per_shard + (i < remainder ? 1 : 0), args...);
+    }
+}
+
+
+/* sum of the shard capacities, equal to the requested capacity */
+template<typename Cache>
+typename ShardedCache<Cache>::size_type ShardedCache<Cache>::capacity() const noexcept {
+
+    size_type ret = 0;
+    for(auto &shard : shards_){
+        ret += shard.cache_.capacity();
+    }
+    return ret;
+}
+
+
+template<typename Cache>
+typename ShardedCache<Cache>::Shard& ShardedCache<Cache>::shard_for_(const key_type &key) {
+
+    return shards_[hash_(key) % shards_.size()];
+}
+
+
+template<typename Cache>
+std::optional<typename ShardedCache<Cache>::mapped_type> ShardedCache<Cache>::get(const key_type &key) {
+
+    auto &shard = shard_for_(key);
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+
+    auto value = shard.cache_.get(key);
+    if(value == nullptr){
+        return std::nullopt;
+    }
+    return *value;
+}
+
+
+template<typename Cache>
+bool ShardedCache<Cache>::contains(const key_type &key) {
+
+    auto &shard = shard_for_(key);
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+
+    return shard.cache_.contains(key);
+}
+
+
+template<typename Cache>
+void ShardedCache<Cache>::put(const key_type &key, mapped_type value) {
+
+    auto &shard = shard_for_(key);
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+
+    shard.cache_.put(key, std::move(value));
+}
+
+
+template<typename Cache>
+bool ShardedCache<Cache>::erase(const key_type &key) {
+
+    auto &shard = shard_for_(key);
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+
+    return shard.cache_.erase(key);
+}
+
+
+template<typename Cache>
+void ShardedCache<Cache>::clear() {
+
+    for(auto &shard : shards_){
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        shard.cache_.clear();
+    }
+}
+
+
+template<typename Cache>
+void ShardedCache<Cache>::set_eviction_callback(const eviction_callback &callback) {
+
+    for(auto &shard : shards_){
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        shard.cache_.set_eviction_callback(callback);
+    }
+}
+
+
+/* not a snapshot: shards are counted one by one */
+template<typename Cache>
+typename ShardedCache<Cache>::size_type ShardedCache<Cache>::size() {
+
+    size_type ret = 0;
+    for(auto &shard : shards_){
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        ret += shard.cache_.size();
+    }
+    return ret;
+}
+
+
+template<typename Cache>
+typename ShardedCache<Cache>::size_type ShardedCache<Cache>::shard_count() const noexcept {
+
+    return shards_.size();
+}
+
+
+#endif //LINKEDLIST_LRUCACHE_H
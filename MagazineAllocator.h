@@ -0,0 +1,316 @@
+#ifndef LINKEDLIST_MAGAZINEALLOCATOR_H
+#define LINKEDLIST_MAGAZINEALLOCATOR_H
+
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+
+/* Node allocator with per-thread caches, meant as the Allocator of a
+ * LinkedList that is built on one thread and destroyed on another.
+ *
+ * Every block size has a shared depot of magazines, a magazine being a
+ * chain of up to MagazineSize free blocks. Each thread keeps two magazines
+ * per size: allocate and deallocate touch only those, without locking.
+ * When both are empty a magazine is taken from the depot, when both are
+ * full one is handed back, so threads meet the depot lock once per
+ * MagazineSize operations. Blocks have no owning thread: a node freed on
+ * a foreign thread goes into that thread's magazines and is reused by
+ * whichever thread next takes the magazine from the depot.
+ *
+ * A thread caches at most 2 * MagazineSize blocks per size and returns
+ * them to the depot when it exits; frees after that go to the depot one
+ * by one. The depot pours such partial returns together, so it holds full
+ * magazines and at most one partial one.
+ *
+ * Memory is taken from the system in slabs of one magazine and is never
+ * given back: the depot keeps every block it has handed out, so a size
+ * class holds on to its peak number of live blocks for the life of the
+ * process. Requests for more than one object go to std::allocator. */
+
+namespace detail{
+
+
+    struct FreeBlock {
+        FreeBlock* next_;
+    };
+
+
+    struct Magazine {
+        FreeBlock* head_ = nullptr;
+        std::size_t count_ = 0;
+
+        void push(FreeBlock* block) noexcept{
+            block->next_ = head_;
+            head_ = block;
+            ++count_;
+        }
+
+        FreeBlock* pop() noexcept{
+            FreeBlock* block = head_;
+            head_ = block->next_;
+            --count_;
+            return block;
+        }
+    };
+
+
+    template<std::size_t Size, std::size_t Align, std::size_t MagazineSize>
+    class MagazineDepot {
+
+    public:
+
+        /* never destroyed, lists with static storage may free into it at exit */
+        static MagazineDepot& instance(){
+            static MagazineDepot* depot = new MagazineDepot;
+            return *depot;
+        }
+
+        /* a full magazine if there is one, the partial one otherwise */
+        Magazine take(){
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if(!full_.empty()){
+                    Magazine ret = full_.back();
+                    full_.pop_back();
+                    return ret;
+                }
+                if(partial_.count_ > 0){
+                    return std::exchange(partial_, Magazine());
+                }
+            }
+            return allocate_slab_();
+        }
+
+        /* for threads whose cache is already gone */
+        void* take_one(){
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if(partial_.count_ == 0 && !full_.empty()){
+                    partial_ = full_.back();
+                    full_.pop_back();
+                }
+                if(partial_.count_ > 0){
+                    return partial_.pop();
+                }
+            }
+            Magazine slab = allocate_slab_();
+            void* ret = slab.pop();
+            put(slab);
+            return ret;
+        }
+
+        /* A partial magazine is poured into the depot's partial one, the
+         * smaller into the larger, and whatever fills up is stacked as full.
+         * If the depot cannot grow the blocks are dropped rather than thrown */
+        void put(Magazine magazine) noexcept{
+            if(magazine.count_ == 0){
+                return;
+            }
+            try{
+                std::lock_guard<std::mutex> lock(mutex_);
+                if(magazine.count_ < MagazineSize){
+                    if(partial_.count_ < magazine.count_){
+                        std::swap(partial_, magazine);
+                    }
+                    while(magazine.count_ > 0 && partial_.count_ < MagazineSize){
+                        partial_.push(magazine.pop());
+                    }
+                    if(partial_.count_ < MagazineSize){
+                        return;
+                    }
+                    std::swap(partial_, magazine);
+                }
+                full_.push_back(magazine);
+            }catch(...){
+            }
+        }
+
+    private:
+
+        MagazineDepot() = default;
+
+        /* one system allocation carved into a full magazine */
+        static Magazine allocate_slab_(){
+            auto slab = static_cast<std::byte*>(::operator new(Size * MagazineSize, std::align_val_t(Align)));
+
+            Magazine ret;
+            for(std::size_t i=MagazineSize; i-- > 0;){
+                ret.push(reinterpret_cast<FreeBlock*>(slab + i * Size));
+            }
+            return ret;
+        }
+
+    private:
+
+        std::mutex mutex_;
+        std::vector<Magazine> full_;
+        Magazine partial_;
+
+    };
+
+
+    template<std::size_t Size, std::size_t Align, std::size_t MagazineSize>
+    class MagazineCache {
+
+    private:
+
+        using depot_type = MagazineDepot<Size, Align, MagazineSize>;
+
+        /* trivially destructible, so it can still be read after the cache is gone */
+        static inline thread_local bool retired_ = false;
+
+    public:
+
+        static void* allocate(){
+            if(retired_){
+                return depot_type::instance().take_one();
+            }
+            return local_().allocate_();
+        }
+
+        static bool retired() noexcept{
+            return retired_;
+        }
+
+        static void deallocate(void* p) noexcept{
+            if(retired_){
+                Magazine single;
+                single.push(static_cast<FreeBlock*>(p));
+                depot_type::instance().put(single);
+                return;
+            }
+            local_().deallocate_(static_cast<FreeBlock*>(p));
+        }
+
+    private:
+
+        MagazineCache() = default;
+
+        ~MagazineCache(){
+            depot_type::instance().put(loaded_);
+            depot_type::instance().put(previous_);
+            retired_ = true;
+        }
+
+        static MagazineCache& local_(){
+            static thread_local MagazineCache cache;
+            return cache;
+        }
+
+        void* allocate_(){
+            if(loaded_.count_ == 0){
+                if(previous_.count_ > 0){
+                    std::swap(loaded_, previous_);
+                }else{
+                    loaded_ = depot_type::instance().take();
+                }
+            }
+            return loaded_.pop();
+        }
+
+        void deallocate_(FreeBlock* block) noexcept{
+            if(loaded_.count_ == MagazineSize){
+                if(previous_.count_ == MagazineSize){
+                    depot_type::instance().put(previous_);
+                    previous_ = Magazine();
+                }
+                std::swap(loaded_, previous_);
+            }
+            loaded_.push(block);
+        }
+
+    private:
+
+        Magazine loaded_;
+        Magazine previous_;
+
+    };
+}
+
+
+
+template<typename T, std::size_t MagazineSize = 64>
+class MagazineAllocator {
+
+public:
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using is_always_equal = std::true_type;
+
+    template<typename U>
+    struct rebind {
+        using other = MagazineAllocator<U, MagazineSize>;
+    };
+
+private:
+
+    static_assert(MagazineSize > 0);
+
+    static constexpr std::size_t align_ = std::max(alignof(T), alignof(detail::FreeBlock));
+    static constexpr std::size_t size_ = (std::max(sizeof(T), sizeof(detail::FreeBlock)) + align_ - 1) / align_ * align_;
+
+    using cache_type = detail::MagazineCache<size_, align_, MagazineSize>;
+
+public:
+
+    MagazineAllocator() noexcept = default;
+    template<typename U>
+    MagazineAllocator(const MagazineAllocator<U, MagazineSize>&) noexcept{}
+
+public:
+
+    T* allocate(size_type n);
+    void deallocate(T* p, size_type n) noexcept;
+
+    /* true once the calling thread's cache for this block size is gone,
+     * from then on its calls go to the depot one block at a time */
+    static bool thread_cache_retired() noexcept;
+
+};
+
+
+template<typename T, std::size_t MagazineSize>
+T* MagazineAllocator<T, MagazineSize>::allocate(size_type n) {
+
+    if(n != 1){
+        return std::allocator<T>().allocate(n);
+    }
+
+    return static_cast<T*>(cache_type::allocate());
+}
+
+
+template<typename T, std::size_t MagazineSize>
+void MagazineAllocator<T, MagazineSize>::deallocate(T *p, size_type n) noexcept {
+
+    if(n != 1){
+        std::allocator<T>().deallocate(p, n);
+        return;
+    }
+
+    cache_type::deallocate(p);
+}
+
+
+template<typename T, std::size_t MagazineSize>
+bool MagazineAllocator<T, MagazineSize>::thread_cache_retired() noexcept {
+
+    return cache_type::retired();
+}
+
+
+template<typename T, typename U, std::size_t MagazineSize>
+bool operator ==(const MagazineAllocator<T, MagazineSize>&, const MagazineAllocator<U, MagazineSize>&) noexcept{
+    return true;
+}
+
+
+#endif //LINKEDLIST_MAGAZINEALLOCATOR_H
@@ -0,0 +1,817 @@
+#ifndef LINKEDLIST_SORTEDLINKEDLIST_H
+#define LINKEDLIST_SORTEDLINKEDLIST_H
+
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+#include "LinkedList.h"
+
+
+/* Sorted list over the plain LinkedList nodes with a probabilistic skip
+ * index on top. Each level above the list is a forward chain of towers
+ * pointing at list nodes, a node is promoted to the next level with
+ * probability 1/4, which gives O(log n) expected search with about a third
+ * of a tower per element. Equal elements are kept in insertion order. */
+
+template<typename T, typename Compare, typename Allocator>
+class SortedLinkedList;
+
+namespace detail{
+
+
+    /* list element: the value and how many towers stand on it, so erasing
+     * an element without towers never has to look for them */
+    template<typename T>
+    struct SortedEntry {
+        T value_;
+        /* index bookkeeping, not part of the value */
+        mutable std::uint8_t height_ = 0;
+    };
+
+
+    /* value_ caches &it_->value_ so a search step reads the key without visiting
+     * the list node, it is null in the heads */
+    template<typename T, typename ListIterator>
+    struct SkipNode {
+        const T* value_;
+        ListIterator it_;
+        SkipNode* next_;
+        SkipNode* down_;
+    };
+
+
+    /* read-only iterator over the values of a list of SortedEntry */
+    template<typename T, typename ListIterator>
+    class SortedIterator {
+
+    private:
+        ListIterator it_;
+    public:
+
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        template<typename, typename, typename>
+        friend class ::SortedLinkedList;
+
+        SortedIterator(): it_(){};
+        explicit SortedIterator(ListIterator it): it_(it){};
+
+        SortedIterator& operator ++(){
+            ++it_;
+            return *this;
+        }
+
+        SortedIterator operator ++(int){
+            return SortedIterator(it_++);
+        }
+
+        SortedIterator& operator --(){
+            --it_;
+            return *this;
+        }
+
+        SortedIterator operator --(int){
+            return SortedIterator(it_--);
+        }
+
+        bool operator ==(const SortedIterator& other) const{
+            return it_ == other.it_;
+        }
+        bool operator !=(const SortedIterator& other) const{
+            return it_ != other.it_;
+        }
+
+        const T& operator *() const{
+            return it_->value_;
+        }
+
+        const T* operator ->() const{
+            return std::addressof(it_->value_);
+        }
+    };
+}
+
+
+
+template<typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T>>
+class SortedLinkedList {
+
+public:
+
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using value_compare = Compare;
+    using allocator_type = Allocator;
+    using const_reference = const value_type&;
+
+private:
+
+    using entry_type = detail::SortedEntry<T>;
+    using entry_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<entry_type>;
+    using list_type = LinkedList<entry_type, entry_allocator_type>;
+    using list_iterator = typename list_type::const_iterator;
+
+public:
+
+    /* elements are immutable, changing one in place would break the order */
+    using iterator = detail::SortedIterator<T, list_iterator>;
+    using const_iterator = iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = reverse_iterator;
+
+private:
+
+    using skip_node = detail::SkipNode<T, list_iterator>;
+    using skip_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<skip_node>;
+
+    static constexpr size_type max_level_ = 32;
+    static constexpr size_type gallop_steps_ = 8;
+
+public:
+
+    explicit SortedLinkedList(Compare comp = Compare());
+    SortedLinkedList(const SortedLinkedList& other);
+    template<std::input_iterator InputIt>
+    SortedLinkedList(InputIt first, InputIt last, Compare comp = Compare());
+    SortedLinkedList(std::initializer_list<T> init, Compare comp = Compare());
+    ~SortedLinkedList();
+
+    SortedLinkedList& operator=(const SortedLinkedList& other);
+
+public:
+
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+    const_reverse_iterator rbegin() const noexcept;
+    const_reverse_iterator rend() const noexcept;
+
+    const_reference front() const;
+    const_reference back() const;
+
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+
+public:
+
+    iterator insert(const T& value);
+    iterator insert(T&& value);
+
+    iterator erase(const_iterator pos);
+    size_type erase(const T& value);
+    void clear() noexcept;
+
+public:
+
+    const_iterator find(const T& value) const;
+    const_iterator lower_bound(const T& value) const;
+    const_iterator upper_bound(const T& value) const;
+    [[nodiscard]] bool contains(const T& value) const;
+
+public:
+
+    void merge(SortedLinkedList& other);
+    void merge(SortedLinkedList&& other);
+
+    void set_union(SortedLinkedList& other);
+    void set_intersection(const SortedLinkedList& other);
+    void set_difference(const SortedLinkedList& other);
+
+private:
+
+    bool before_(const T& element, const T& value, bool upper) const;
+    skip_node* descend_(const T& value, bool upper, skip_node** update) const;
+    list_iterator search_(const T& value, bool upper, skip_node** update) const;
+    list_iterator gallop_(list_iterator it, const T& value) const;
+
+    size_type random_level_() noexcept;
+    void add_towers_(list_iterator it, skip_node** update);
+    void remove_towers_(list_iterator pos);
+    void clear_index_() noexcept;
+    void rebuild_index_();
+
+    [[nodiscard]] bool prefer_search_(size_type count) const noexcept;
+
+    template<typename U>
+    iterator insert_(U&& value);
+
+private:
+
+    list_type list_;
+    std::vector<skip_node*> heads_;
+    Compare comp_;
+    std::uint64_t seed_ = 0x9e3779b97f4a7c15ull;
+
+};
+
+
+/* Constructors and assignment operators */
+template<typename T, typename Compare, typename Allocator>
+SortedLinkedList<T, Compare, Allocator>::SortedLinkedList(Compare comp): comp_(std::move(comp)){}
+
+
+template<typename T, typename Compare, typename Allocator>
+SortedLinkedList<T, Compare, Allocator>::SortedLinkedList(const SortedLinkedList &other):
+list_(other.list_), comp_(other.comp_){
+
+    rebuild_index_();
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+template<std::input_iterator InputIt>
+SortedLinkedList<T, Compare, Allocator>::SortedLinkedList(InputIt first, InputIt last, Compare comp):
+comp_(std::move(comp)){
+
+    for(; first != last; ++first){
+        insert(*first);
+    }
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+SortedLinkedList<T, Compare, Allocator>::SortedLinkedList(std::initializer_list<T> init, Compare comp):
+SortedLinkedList(init.begin(), init.end(), std::move(comp)){}
+
+
+template<typename T, typename Compare, typename Allocator>
+SortedLinkedList<T, Compare, Allocator>::~SortedLinkedList() {
+
+    clear_index_();
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+SortedLinkedList<T, Compare, Allocator>&
+SortedLinkedList<T, Compare, Allocator>::operator=(const SortedLinkedList &other) {
+
+    if(this == &other){
+        return *this;
+    }
+
+    clear();
+    comp_ = other.comp_;
+    list_ = other.list_;
+    rebuild_index_();
+
+    return *this;
+}
+
+
+/* skip index */
+template<typename T, typename Compare, typename Allocator>
+bool SortedLinkedList<T, Compare, Allocator>::before_(const T &element, const T &value, bool upper) const {
+
+    return upper ? !comp_(value, element) : comp_(element, value);
+}
+
+
+/* last tower on level 0 before value, or the level 0 head;
+ * update[i] gets the last tower before value on level i */
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::skip_node*
+SortedLinkedList<T, Compare, Allocator>::descend_(const T &value, bool upper, skip_node** update) const {
+
+    skip_node* cur = heads_.back();
+    for(size_type level = heads_.size(); level-- > 0;){
+        while(cur->next_ != nullptr && before_(*cur->next_->value_, value, upper)){
+            cur = cur->next_;
+        }
+        if(update != nullptr){
+            update[level] = cur;
+        }
+        if(level > 0){
+            cur = cur->down_;
+        }
+    }
+
+    return cur;
+}
+
+
+/* first element not before value */
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::list_iterator
+SortedLinkedList<T, Compare, Allocator>::search_(const T &value, bool upper, skip_node** update) const {
+
+    auto it = list_.cbegin();
+
+    if(!heads_.empty()){
+        skip_node* cur = descend_(value, upper, update);
+        if(cur->value_ != nullptr){
+            it = cur->it_;
+        }
+    }
+
+    while(it != list_.cend() && before_(it->value_, value, upper)){
+        ++it;
+    }
+
+    return it;
+}
+
+
+/* first element after value, starting at it; nothing before it may be after value.
+ * Short distances are walked, past gallop_steps_ nodes the rest is found through
+ * the index, resuming from the tower if it is not behind it */
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::list_iterator
+SortedLinkedList<T, Compare, Allocator>::gallop_(list_iterator it, const T &value) const {
+
+    for(size_type step=0; step<gallop_steps_; ++step, ++it){
+        if(it == list_.cend() || comp_(value, it->value_)){
+            return it;
+        }
+    }
+
+    if(it != list_.cend() && !heads_.empty()){
+        skip_node* cur = descend_(value, true, nullptr);
+        if(cur->value_ != nullptr && !comp_(*cur->value_, it->value_)){
+            it = cur->it_;
+        }
+    }
+
+    while(it != list_.cend() && !comp_(value, it->value_)){
+        ++it;
+    }
+
+    return it;
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::size_type
+SortedLinkedList<T, Compare, Allocator>::random_level_() noexcept {
+
+    seed_ ^= seed_ << 13;
+    seed_ ^= seed_ >> 7;
+    seed_ ^= seed_ << 17;
+
+    size_type level = 0;
+    for(auto bits = seed_; (bits & 3u) == 0 && level < max_level_; bits >>= 2){
+        ++level;
+    }
+    return level;
+}
+
+
+/* towers are allocated before anything is linked, so a throw leaves the index intact */
+template<typename T, typename Compare, typename Allocator>
+void SortedLinkedList<T, Compare, Allocator>::add_towers_(list_iterator it, skip_node** update) {
+
+    size_type levels = random_level_();
+    it->height_ = 0;
+    if(levels == 0){
+        return;
+    }
+
+    skip_allocator_type alloc;
+    skip_node* towers[max_level_];
+    size_type built = 0;
+
+    heads_.reserve(max_level_);
+
+    try{
+        while(heads_.size() < levels){
+            skip_node* head = std::allocator_traits<skip_allocator_type>::allocate(alloc, 1ull);
+            *head = skip_node{nullptr, list_.cend(), nullptr, heads_.empty() ? nullptr : heads_.back()};
+            heads_.push_back(head);
+            update[heads_.size() - 1] = head;
+        }
+        for(; built < levels; ++built){
+            towers[built] = std::allocator_traits<skip_allocator_type>::allocate(alloc, 1ull);
+        }
+    }catch(...){
+        for(size_type i=0; i<built; ++i){
+            std::allocator_traits<skip_allocator_type>::deallocate(alloc, towers[i], 1ull);
+        }
+        throw;
+    }
+
+    for(size_type level=0; level<levels; ++level){
+        *towers[level] = skip_node{std::addressof(it->value_), it, update[level]->next_, level == 0 ? nullptr : towers[level - 1]};
+        update[level]->next_ = towers[level];
+    }
+    it->height_ = static_cast<std::uint8_t>(levels);
+}
+
+
+/* only elements with towers search for them, equal keys are scanned on
+ * each of their levels, which is one tower in four per level above */
+template<typename T, typename Compare, typename Allocator>
+void SortedLinkedList<T, Compare, Allocator>::remove_towers_(list_iterator pos) {
+
+    if(pos->height_ == 0 || heads_.empty()){
+        return;
+    }
+
+    skip_allocator_type alloc;
+    skip_node* update[max_level_];
+    search_(pos->value_, false, update);
+
+    for(size_type level=0; level<pos->height_ && level<heads_.size(); ++level){
+        skip_node* cur = update[level];
+        while(cur->next_ != nullptr && cur->next_->it_ != pos && !comp_(pos->value_, *cur->next_->value_)){
+            cur = cur->next_;
+        }
+        if(cur->next_ == nullptr || cur->next_->it_ != pos){
+            break;
+        }
+        auto victim = cur->next_;
+        cur->next_ = victim->next_;
+        std::allocator_traits<skip_allocator_type>::deallocate(alloc, victim, 1ull);
+    }
+
+    while(!heads_.empty() && heads_.back()->next_ == nullptr){
+        std::allocator_traits<skip_allocator_type>::deallocate(alloc, heads_.back(), 1ull);
+        heads_.pop_back();
+    }
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+void SortedLinkedList<T, Compare, Allocator>::clear_index_() noexcept {
+
+    skip_allocator_type alloc;
+
+    for(auto head : heads_){
+        for(skip_node* cur = head; cur != nullptr;){
+            auto next = cur->next_;
+            std::allocator_traits<skip_allocator_type>::deallocate(alloc, cur, 1ull);
+            cur = next;
+        }
+    }
+
+    heads_.clear();
+}
+
+
+/* one pass over the list, towers are appended to the tail of each level */
+template<typename T, typename Compare, typename Allocator>
+void SortedLinkedList<T, Compare, Allocator>::rebuild_index_() {
+
+    clear_index_();
+
+    skip_node* tails[max_level_];
+    for(auto it = list_.cbegin(); it != list_.cend(); ++it){
+        add_towers_(it, tails);
+        for(size_type level=0; level<heads_.size(); ++level){
+            if(tails[level]->next_ != nullptr){
+                tails[level] = tails[level]->next_;
+            }
+        }
+    }
+}
+
+
+/* k searches of O(log n) pay off against one linear pass when k is small */
+template<typename T, typename Compare, typename Allocator>
+bool SortedLinkedList<T, Compare, Allocator>::prefer_search_(size_type count) const noexcept {
+
+    size_type log_n = 1;
+    for(auto n = list_.size(); n > 1; n >>= 1){
+        ++log_n;
+    }
+
+    return count * log_n < list_.size();
+}
+
+
+/* insert methods */
+template<typename T, typename Compare, typename Allocator>
+template<typename U>
+typename SortedLinkedList<T, Compare, Allocator>::iterator
+SortedLinkedList<T, Compare, Allocator>::insert_(U &&value) {
+
+    skip_node* update[max_level_];
+    auto pos = search_(value, true, update);
+    list_iterator it = list_.emplace(pos, std::forward<U>(value));
+
+    try{
+        add_towers_(it, update);
+    }catch(...){
+        list_.erase(it);
+        throw;
+    }
+
+    return iterator(it);
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::iterator
+SortedLinkedList<T, Compare, Allocator>::insert(const T &value) {
+
+    return insert_(value);
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::iterator
+SortedLinkedList<T, Compare, Allocator>::insert(T &&value) {
+
+    return insert_(std::move(value));
+}
+
+
+/* erase methods */
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::iterator
+SortedLinkedList<T, Compare, Allocator>::erase(const_iterator pos) {
+
+    remove_towers_(pos.it_);
+    return iterator(list_.erase(pos.it_));
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::size_type
+SortedLinkedList<T, Compare, Allocator>::erase(const T &value) {
+
+    /* value may be one of the erased elements, so the range is found before anything is freed */
+    auto first = lower_bound(value);
+    auto last = upper_bound(value);
+
+    size_type ret = 0;
+    for(; first != last; ++ret){
+        first = erase(first);
+    }
+
+    return ret;
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+void SortedLinkedList<T, Compare, Allocator>::clear() noexcept {
+
+    clear_index_();
+    list_.clear();
+}
+
+
+/* lookup methods */
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::const_iterator
+SortedLinkedList<T, Compare, Allocator>::find(const T &value) const {
+
+    auto it = lower_bound(value);
+    return it != end() && !comp_(value, *it) ? it : end();
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::const_iterator
+SortedLinkedList<T, Compare, Allocator>::lower_bound(const T &value) const {
+
+    return const_iterator(search_(value, false, nullptr));
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::const_iterator
+SortedLinkedList<T, Compare, Allocator>::upper_bound(const T &value) const {
+
+    return const_iterator(search_(value, true, nullptr));
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+bool SortedLinkedList<T, Compare, Allocator>::contains(const T &value) const {
+
+    return find(value) != end();
+}
+
+
+/* merge methods, nodes of other are relinked, nothing is copied.
+ * A small other is merged by one skip search per element, near O(k log n).
+ * Otherwise other is spliced in runs: the end of each run of other is walked,
+ * since its nodes are relinked anyway, while the end of each run of *this is
+ * found by gallop_, so long stretches of *this are skipped through the index.
+ * Spliced nodes have no towers until the index is rebuilt at the end, which
+ * keeps the index valid, only sparser. Equal elements of other go after ours. */
+template<typename T, typename Compare, typename Allocator>
+void SortedLinkedList<T, Compare, Allocator>::merge(SortedLinkedList &other) {
+
+    if(this == &other || other.empty()){
+        return;
+    }
+
+    other.clear_index_();
+
+    if(prefer_search_(other.size())){
+        skip_node* update[max_level_];
+        while(!other.list_.empty()){
+            auto node = other.list_.cbegin();
+            auto pos = search_(node->value_, true, update);
+            list_.splice(pos, other.list_, node);
+            add_towers_(node, update);
+        }
+        return;
+    }
+
+    auto it = list_.cbegin();
+    while(!other.list_.empty()){
+        auto first = other.list_.cbegin();
+        it = gallop_(it, first->value_);
+        if(it == list_.cend()){
+            list_.splice(it, other.list_);
+            break;
+        }
+        auto last = std::next(first);
+        while(last != other.list_.cend() && comp_(last->value_, it->value_)){
+            ++last;
+        }
+        list_.splice(it, other.list_, first, last);
+    }
+
+    rebuild_index_();
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+void SortedLinkedList<T, Compare, Allocator>::merge(SortedLinkedList &&other) {
+
+    merge(other);
+}
+
+
+/* set methods, all work in place */
+
+/* elements of other not found here are relinked into *this, the rest stay in other */
+template<typename T, typename Compare, typename Allocator>
+void SortedLinkedList<T, Compare, Allocator>::set_union(SortedLinkedList &other) {
+
+    if(this == &other || other.empty()){
+        return;
+    }
+
+    other.clear_index_();
+
+    skip_node* update[max_level_];
+    for(auto node = other.list_.cbegin(); node != other.list_.cend();){
+        auto next = std::next(node);
+        auto pos = search_(node->value_, false, update);
+        if(pos == list_.cend() || comp_(node->value_, pos->value_)){
+            list_.splice(pos, other.list_, node);
+            add_towers_(node, update);
+        }
+        node = next;
+    }
+
+    other.rebuild_index_();
+}
+
+
+/* keep only elements whose key is present in other */
+template<typename T, typename Compare, typename Allocator>
+void SortedLinkedList<T, Compare, Allocator>::set_intersection(const SortedLinkedList &other) {
+
+    if(this == &other){
+        return;
+    }
+
+    clear_index_();
+
+    auto theirs = other.list_.cbegin();
+    for(auto it = list_.cbegin(); it != list_.cend();){
+        while(theirs != other.list_.cend() && comp_(theirs->value_, it->value_)){
+            ++theirs;
+        }
+        if(theirs == other.list_.cend() || comp_(it->value_, theirs->value_)){
+            it = list_.erase(it);
+        }else{
+            ++it;
+        }
+    }
+
+    rebuild_index_();
+}
+
+
+/* drop elements whose key is present in other */
+template<typename T, typename Compare, typename Allocator>
+void SortedLinkedList<T, Compare, Allocator>::set_difference(const SortedLinkedList &other) {
+
+    if(this == &other){
+        clear();
+        return;
+    }
+
+    if(prefer_search_(other.size())){
+        for(auto &i : other){
+            erase(i);
+        }
+        return;
+    }
+
+    clear_index_();
+
+    auto theirs = other.list_.cbegin();
+    for(auto it = list_.cbegin(); it != list_.cend();){
+        while(theirs != other.list_.cend() && comp_(theirs->value_, it->value_)){
+            ++theirs;
+        }
+        if(theirs != other.list_.cend() && !comp_(it->value_, theirs->value_)){
+            it = list_.erase(it);
+        }else{
+            ++it;
+        }
+    }
+
+    rebuild_index_();
+}
+
+
+/* iterators and accessors */
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::const_iterator
+SortedLinkedList<T, Compare, Allocator>::begin() const noexcept {
+
+    return const_iterator(list_.cbegin());
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::const_iterator
+SortedLinkedList<T, Compare, Allocator>::cbegin() const noexcept {
+
+    return const_iterator(list_.cbegin());
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::const_iterator
+SortedLinkedList<T, Compare, Allocator>::end() const noexcept {
+
+    return const_iterator(list_.cend());
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::const_iterator
+SortedLinkedList<T, Compare, Allocator>::cend() const noexcept {
+
+    return const_iterator(list_.cend());
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::const_reverse_iterator
+SortedLinkedList<T, Compare, Allocator>::rbegin() const noexcept {
+
+    return const_reverse_iterator(end());
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::const_reverse_iterator
+SortedLinkedList<T, Compare, Allocator>::rend() const noexcept {
+
+    return const_reverse_iterator(begin());
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::const_reference
+SortedLinkedList<T, Compare, Allocator>::front() const {
+
+    return list_.front().value_;
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::const_reference
+SortedLinkedList<T, Compare, Allocator>::back() const {
+
+    return list_.back().value_;
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+typename SortedLinkedList<T, Compare, Allocator>::size_type
+SortedLinkedList<T, Compare, Allocator>::size() const noexcept {
+
+    return list_.size();
+}
+
+
+template<typename T, typename Compare, typename Allocator>
+bool SortedLinkedList<T, Compare, Allocator>::empty() const noexcept {
+
+    return list_.empty();
+}
+
+
+#endif //LINKEDLIST_SORTEDLINKEDLIST_H
@@ -0,0 +1,76 @@
+// LinkedList against std::list: build, copy, traversal and clear for int and a small POD.
+// g++ -std=c++20 -O2 -DNDEBUG -I.. list_bench.cpp -o list_bench && ./list_bench
+
+#include <chrono>
+#include <cstdio>
+#include <list>
+#include <type_traits>
+
+#include "../LinkedList.h"
+
+
+struct Pod {
+    int a, b, c, d;
+};
+
+
+template<typename T>
+T make_element(int i){
+    if constexpr(std::is_same_v<T, Pod>){
+        return Pod{i, 0, 0, 0};
+    }else{
+        return T(i);
+    }
+}
+
+
+template<typename F>
+double measure_ms(F f){
+
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+template<typename List>
+void run(const char* name){
+
+    const int elements = 2000000;
+    const int rounds = 5;
+    double build = 0, copy = 0, traverse = 0, clear = 0;
+    long sink = 0;
+
+    for(int round=0; round<rounds; ++round){
+        List l;
+        build += measure_ms([&]{
+            for(int i=0; i<elements; ++i){
+                l.push_back(make_element<typename List::value_type>(i));
+            }
+        });
+
+        List c;
+        copy += measure_ms([&]{ c = l; });
+        traverse += measure_ms([&]{
+            for(auto &i : c){
+                sink += reinterpret_cast<const int&>(i);
+            }
+        });
+        clear += measure_ms([&]{ c.clear(); });
+    }
+
+    std::printf("  %-18s push_back %7.1f ms  copy %7.1f ms  traverse %6.1f ms  clear %6.1f ms  (%ld)\n",
+                name, build / rounds, copy / rounds, traverse / rounds, clear / rounds, sink);
+}
+
+
+int main(){
+
+    std::printf("%d elements, mean of 5 rounds\n", 2000000);
+    run<std::list<int>>("std::list<int>");
+    run<LinkedList<int>>("LinkedList<int>");
+    run<std::list<Pod>>("std::list<Pod>");
+    run<LinkedList<Pod>>("LinkedList<Pod>");
+
+    return 0;
+}
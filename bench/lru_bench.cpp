@@ -0,0 +1,128 @@
+// LruCache against a std::list + std::unordered_map reference on a Zipfian workload.
+// g++ -std=c++20 -O2 -DNDEBUG -I.. lru_bench.cpp -o lru_bench && ./lru_bench
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <list>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "../LruCache.h"
+
+
+/* the hand-rolled cache LruCache replaces */
+template<typename K, typename V>
+class StdListLru {
+
+public:
+
+    explicit StdListLru(std::size_t capacity): capacity_(capacity){}
+
+    V* get(const K& key){
+        auto found = index_.find(key);
+        if(found == index_.end()){
+            return nullptr;
+        }
+        entries_.splice(entries_.begin(), entries_, found->second);
+        return &found->second->second;
+    }
+
+    void put(const K& key, V value){
+        auto found = index_.find(key);
+        if(found != index_.end()){
+            found->second->second = std::move(value);
+            entries_.splice(entries_.begin(), entries_, found->second);
+            return;
+        }
+        if(entries_.size() == capacity_){
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+        entries_.emplace_front(key, std::move(value));
+        index_.emplace(key, entries_.begin());
+    }
+
+private:
+
+    std::list<std::pair<K, V>> entries_;
+    std::unordered_map<K, typename std::list<std::pair<K, V>>::iterator> index_;
+    std::size_t capacity_;
+
+};
+
+
+/* keys 0..n-1 with P(k) ~ 1 / (k + 1)^s, sampled from the cumulative table */
+class Zipf {
+
+public:
+
+    Zipf(std::size_t n, double s, std::uint64_t seed): rng_(seed){
+        cdf_.reserve(n);
+        double sum = 0;
+        for(std::size_t k=0; k<n; ++k){
+            sum += 1.0 / std::pow(double(k + 1), s);
+            cdf_.push_back(sum);
+        }
+        for(auto &c : cdf_){
+            c /= sum;
+        }
+    }
+
+    std::size_t operator ()(){
+        double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng_);
+        return std::lower_bound(cdf_.begin(), cdf_.end(), u) - cdf_.begin();
+    }
+
+private:
+
+    std::mt19937_64 rng_;
+    std::vector<double> cdf_;
+
+};
+
+
+template<typename Cache>
+void run(const char* name, const std::vector<std::size_t>& keys, std::size_t capacity){
+
+    Cache cache(capacity);
+    std::size_t hits = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for(auto key : keys){
+        if(auto value = cache.get(key)){
+            hits += *value == key;
+        }else{
+            cache.put(key, key);
+        }
+    }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("  %-12s %8.1f ms  %6.1f Mops/s  hit rate %.3f\n",
+                name, ms, keys.size() / ms / 1000.0, double(hits) / keys.size());
+}
+
+
+int main(){
+
+    const std::size_t universe = 1000000;
+    const std::size_t operations = 10000000;
+
+    for(double s : {0.8, 0.99, 1.2}){
+        Zipf zipf(universe, s, 42);
+        std::vector<std::size_t> keys(operations);
+        for(auto &key : keys){
+            key = zipf();
+        }
+
+        for(std::size_t capacity : {1000u, 100000u}){
+            std::printf("zipf s=%.2f capacity=%zu\n", s, capacity);
+            run<StdListLru<std::size_t, std::size_t>>("std::list", keys, capacity);
+            run<LruCache<std::size_t, std::size_t>>("LruCache", keys, capacity);
+        }
+    }
+
+    return 0;
+}
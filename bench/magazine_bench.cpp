@@ -0,0 +1,106 @@
+// Producer/consumer lists with MagazineAllocator against std::allocator, 1 to 64 threads.
+// Producers build lists and hand them over, consumers walk and destroy them,
+// so every node is freed on a thread other than the one that allocated it.
+// g++ -std=c++20 -O2 -DNDEBUG -pthread -I.. magazine_bench.cpp -o magazine_bench && ./magazine_bench
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../LinkedList.h"
+#include "../MagazineAllocator.h"
+
+
+template<typename Allocator>
+double run(int threads, int lists_per_producer, int length){
+
+    using List = LinkedList<int, Allocator>;
+
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<std::unique_ptr<List>> queue;
+    int producers = threads > 1 ? threads / 2 : 1;
+    int consumers = threads > 1 ? threads - producers : 0;
+    int finished = 0;
+
+    auto produce = [&]{
+        for(int i=0; i<lists_per_producer; ++i){
+            auto l = std::make_unique<List>();
+            for(int k=0; k<length; ++k){
+                l->push_back(k);
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                queue.push_back(std::move(l));
+            }
+            ready.notify_one();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        ++finished;
+        ready.notify_all();
+    };
+
+    auto consume = [&]{
+        long sum = 0;
+        for(;;){
+            std::unique_ptr<List> l;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                ready.wait(lock, [&]{ return !queue.empty() || finished == producers; });
+                if(queue.empty()){
+                    break;
+                }
+                l = std::move(queue.front());
+                queue.pop_front();
+            }
+            for(auto i : *l){
+                sum += i;
+            }
+        }
+        return sum;
+    };
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> pool;
+    for(int i=0; i<producers; ++i){
+        pool.emplace_back(produce);
+    }
+    for(int i=0; i<consumers; ++i){
+        pool.emplace_back(consume);
+    }
+    for(auto &thread : pool){
+        thread.join();
+    }
+    /* a single thread destroys its own lists */
+    if(consumers == 0){
+        consume();
+    }
+
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+
+int main(){
+
+    const int lists = 200;
+    const int length = 5000;
+
+    std::printf("each producer hands over %d lists of %d ints (hardware threads: %u)\n",
+                lists, length, std::thread::hardware_concurrency());
+    std::printf("%8s %14s %14s %14s\n", "threads", "std::allocator", "magazine", "Mnodes/s mag");
+
+    for(int threads=1; threads<=64; threads*=2){
+        double baseline = run<std::allocator<int>>(threads, lists, length);
+        double magazine = run<MagazineAllocator<int>>(threads, lists, length);
+        double nodes = double(threads > 1 ? threads / 2 : 1) * lists * length;
+        std::printf("%8d %11.1f ms %11.1f ms %14.1f\n", threads, baseline, magazine, nodes / magazine / 1000.0);
+    }
+
+    return 0;
+}
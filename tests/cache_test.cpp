@@ -0,0 +1,138 @@
+// LruCache, LfuCache and ShardedCache.
+// g++ -std=c++20 -g -fsanitize=address,undefined -pthread -I.. cache_test.cpp -o cache_test && ./cache_test
+
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../LruCache.h"
+
+
+struct LengthWeigher {
+    std::size_t operator ()(const int&, const std::string& value) const noexcept{
+        return value.size();
+    }
+};
+
+
+void test_lru(){
+
+    LruCache<int, std::string> cache(2);
+    std::vector<int> evicted;
+    cache.set_eviction_callback([&](const int& key, std::string&){ evicted.push_back(key); });
+
+    cache.put(1, "a");
+    cache.put(2, "b");
+    assert(*cache.get(1) == "a");
+    cache.put(3, "c");
+    assert(evicted == std::vector<int>{2});
+    assert(!cache.contains(2) && cache.contains(1) && cache.contains(3));
+
+    /* peek does not promote */
+    assert(*cache.peek(1) == "a");
+    cache.put(4, "d");
+    assert(evicted.back() == 1);
+
+    cache.put(3, "cc");
+    assert(*cache.get(3) == "cc" && cache.size() == 2);
+    assert(cache.erase(3) && !cache.erase(3) && cache.size() == 1);
+
+    /* the pointer from get() stays valid across promotions */
+    cache.put(5, "e");
+    auto value = cache.get(4);
+    cache.get(5);
+    cache.get(4);
+    assert(*value == "d");
+
+    LruCache<int, std::string, LengthWeigher> bytes(10);
+    bytes.put(1, "12345");
+    bytes.put(2, "12345");
+    bytes.put(3, "1");
+    assert(!bytes.contains(1) && bytes.weight() == 6);
+    bytes.put(4, "12345678901");
+    assert(bytes.empty() && bytes.weight() == 0);
+}
+
+
+void test_lfu(){
+
+    LfuCache<int, int> cache(2);
+    cache.put(1, 1);
+    cache.put(2, 2);
+    cache.get(1);
+    cache.get(1);
+    cache.get(2);
+    assert(cache.frequency(1) == 3 && cache.frequency(2) == 2);
+
+    /* the new entry does not push out itself, the least frequent goes */
+    cache.put(3, 3);
+    assert(cache.contains(1) && !cache.contains(2) && cache.contains(3));
+    cache.put(4, 4);
+    assert(!cache.contains(3) && cache.contains(4));
+
+    /* ties are broken by recency */
+    LfuCache<int, int> ties(2);
+    ties.put(1, 1);
+    ties.put(2, 2);
+    ties.put(3, 3);
+    assert(!ties.contains(1));
+
+    assert(cache.erase(1) && cache.size() == 1);
+    cache.clear();
+    for(int i=0; i<1000; ++i){
+        cache.put(i % 7, i);
+        cache.get(i % 3);
+    }
+    assert(cache.size() == 2);
+}
+
+
+void test_sharded(){
+
+    for(std::size_t shards : {1u, 3u, 8u, 16u}){
+        for(std::size_t capacity : {1u, 10u, 64u}){
+            ShardedCache<LruCache<int, int>> cache(shards, capacity);
+            assert(cache.capacity() == capacity);
+            assert(cache.shard_count() <= capacity);
+            for(int i=0; i<1000; ++i){
+                cache.put(i, i);
+            }
+            assert(cache.size() <= capacity);
+        }
+    }
+
+    ShardedCache<LruCache<int, std::string, LengthWeigher>> bytes(4, 30);
+    assert(bytes.capacity() == 30);
+
+    ShardedCache<LruCache<int, int>> cache(8, 64);
+    std::vector<std::thread> threads;
+    for(int t=0; t<4; ++t){
+        threads.emplace_back([&cache, t]{
+            for(int i=0; i<20000; ++i){
+                cache.put((i * 7 + t) % 200, i);
+                cache.get(i % 200);
+            }
+        });
+    }
+    for(auto &thread : threads){
+        thread.join();
+    }
+    assert(cache.size() <= 64);
+
+    ShardedCache<LfuCache<int, int>> lfu(4, 10);
+    lfu.put(1, 1);
+    assert(*lfu.get(1) == 1 && !lfu.get(2));
+}
+
+
+int main(){
+
+    test_lru();
+    test_lfu();
+    test_sharded();
+
+    std::cout << "cache_test ok" << std::endl;
+    return 0;
+}
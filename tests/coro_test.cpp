@@ -0,0 +1,150 @@
+// Generator pipelines and AsyncChannel.
+// g++ -std=c++20 -g -fsanitize=address,undefined -I.. coro_test.cpp -o coro_test && ./coro_test
+
+#include <algorithm>
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include "../LinkedListCoro.h"
+
+
+/* fire-and-forget coroutine, runs eagerly until its first suspension */
+struct Task {
+    struct promise_type {
+        Task get_return_object() noexcept{ return {}; }
+        std::suspend_never initial_suspend() const noexcept{ return {}; }
+        std::suspend_never final_suspend() const noexcept{ return {}; }
+        void return_void() const noexcept{}
+        void unhandled_exception() const noexcept{ std::terminate(); }
+    };
+};
+
+
+Task producer(AsyncChannel<int>& channel, int count, std::vector<bool>& results){
+    for(int i=0; i<count; ++i){
+        results.push_back(co_await channel.push_back(i));
+    }
+}
+
+
+Task consumer(AsyncChannel<int>& channel, std::vector<int>& out, bool& finished){
+    while(auto value = co_await channel.pop_front()){
+        out.push_back(*value);
+    }
+    finished = true;
+}
+
+
+Generator<int> throwing(){
+    co_yield 1;
+    throw std::runtime_error("generator");
+}
+
+
+void test_pipeline(){
+
+    LinkedList<int> list{1, 2, 3, 4, 5, 6};
+
+    auto evens = lazy_filter(lazy_view(list), [](int x){ return x % 2 == 0; });
+    auto scaled = lazy_transform(std::move(evens), [](int x){ return x * 10; });
+    auto result = to_list(std::move(scaled));
+    assert(std::ranges::equal(result, std::vector<int>{20, 40, 60}));
+
+    /* the view yields references into the list */
+    for(auto &i : lazy_view(list)){
+        i += 1;
+    }
+    assert(list.front() == 2 && list.back() == 7);
+
+    const auto &const_list = list;
+    LinkedList<int> copy{0};
+    append(copy, lazy_view(const_list));
+    assert(copy.size() == 7 && copy.back() == 7 && list.size() == 6);
+
+    auto gen = throwing();
+    auto it = gen.begin();
+    assert(*it == 1);
+    bool caught = false;
+    try{
+        ++it;
+    }catch(const std::runtime_error&){
+        caught = true;
+    }
+    assert(caught);
+}
+
+
+void test_channel(std::size_t capacity, bool consumer_first){
+
+    AsyncChannel<int> channel(capacity);
+    std::vector<int> out;
+    std::vector<bool> results;
+    bool finished = false;
+
+    if(consumer_first){
+        consumer(channel, out, finished);
+        producer(channel, 10, results);
+    }else{
+        producer(channel, 10, results);
+        assert(channel.size() == capacity);
+        consumer(channel, out, finished);
+    }
+
+    assert(results.size() == 10);
+    for(int i=0; i<10; ++i){
+        assert(out[i] == i && results[i]);
+    }
+    assert(!finished && channel.empty());
+
+    channel.close();
+    assert(finished);
+}
+
+
+void test_close_with_waiters(){
+
+    /* producers blocked on a full channel see false */
+    {
+        AsyncChannel<int> channel(1);
+        std::vector<bool> results;
+        producer(channel, 3, results);
+        assert(results.size() == 1);
+        channel.close();
+        assert((results == std::vector<bool>{true, false, false}));
+        assert(channel.try_pop_front() == 0);
+        assert(!channel.try_pop_front());
+    }
+
+    /* consumers blocked on an empty channel see nullopt */
+    {
+        AsyncChannel<int> channel(0);
+        std::vector<int> out_a, out_b;
+        bool finished_a = false, finished_b = false;
+        consumer(channel, out_a, finished_a);
+        consumer(channel, out_b, finished_b);
+        assert(channel.try_push_back(1));
+        channel.close();
+        assert(finished_a && finished_b);
+        assert(out_a.size() + out_b.size() == 1);
+        assert(!channel.try_push_back(2));
+    }
+}
+
+
+int main(){
+
+    test_pipeline();
+    for(std::size_t capacity : {0u, 1u, 4u}){
+        test_channel(capacity, true);
+        test_channel(capacity, false);
+    }
+    test_close_with_waiters();
+
+    std::cout << "coro_test ok" << std::endl;
+    return 0;
+}
@@ -0,0 +1,14 @@
+// libFuzzer entry point for the LinkedList lockstep driver.
+// clang++ -std=c++20 -g -O1 -fsanitize=fuzzer,address,undefined -I.. list_fuzz.cpp -o list_fuzz && ./list_fuzz
+
+#include <cstddef>
+#include <cstdint>
+
+#include "list_lockstep.h"
+
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size){
+
+    lockstep_run(data, size);
+    return 0;
+}
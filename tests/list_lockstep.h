@@ -0,0 +1,301 @@
+// Lockstep differential driver shared by list_test.cpp and list_fuzz.cpp:
+// decodes a byte string into operations, applies each one to a pair of
+// LinkedLists and a pair of std::lists, and compares them after every step.
+
+#ifndef LINKEDLIST_TESTS_LIST_LOCKSTEP_H
+#define LINKEDLIST_TESTS_LIST_LOCKSTEP_H
+
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../LinkedList.h"
+
+
+#define LOCKSTEP_CHECK(condition) \
+    do{ \
+        if(!(condition)){ \
+            std::fprintf(stderr, "lockstep: %s failed at line %d, op %u\n", #condition, __LINE__, op); \
+            std::abort(); \
+        } \
+    }while(0)
+
+
+class ByteSource {
+
+public:
+
+    ByteSource(const std::uint8_t* data, std::size_t size): data_(data), size_(size){}
+
+    /* exhausted input reads as zeros */
+    std::uint32_t next(){
+        std::uint32_t ret = 0;
+        for(int i=0; i<2; ++i){
+            ret = ret << 8 | (pos_ < size_ ? data_[pos_++] : 0u);
+        }
+        return ret;
+    }
+
+    std::size_t below(std::size_t bound){
+        return bound == 0 ? 0 : next() % bound;
+    }
+
+    [[nodiscard]] bool done() const noexcept{
+        return pos_ >= size_;
+    }
+
+private:
+
+    const std::uint8_t* data_;
+    std::size_t size_;
+    std::size_t pos_ = 0;
+
+};
+
+
+/* a few distinct values so unique, remove and merge see duplicates;
+ * strings are long enough to live on the heap, which lets ASan see lifetime errors */
+template<typename T>
+T lockstep_value(std::uint32_t v){
+    if constexpr(std::is_same_v<T, std::string>){
+        return std::string(24, char('a' + v % 8));
+    }else{
+        return T(v % 8);
+    }
+}
+
+
+template<typename T>
+void lockstep_run(ByteSource& source){
+
+    LinkedList<T> lists[2];
+    std::list<T> refs[2];
+    unsigned op = 0;
+
+    while(!source.done()){
+        op = source.next() % 26;
+        std::size_t side = source.below(2);
+        auto &l = lists[side], &other = lists[1 - side];
+        auto &r = refs[side], &other_ref = refs[1 - side];
+        T value = lockstep_value<T>(source.next());
+
+        auto at = [](auto& list, std::size_t n){
+            auto it = list.begin();
+            std::advance(it, n);
+            return it;
+        };
+        auto position = [&](bool with_end){
+            return source.below(r.size() + (with_end ? 1 : 0));
+        };
+
+        switch(op){
+            case 0: {
+                auto p = position(true);
+                auto it = l.insert(at(l, p), value);
+                r.insert(at(r, p), value);
+                LOCKSTEP_CHECK(std::distance(l.begin(), it) == std::ptrdiff_t(p));
+                break;
+            }
+            case 1: {
+                if(r.empty()) break;
+                auto p = position(false);
+                auto it = l.erase(at(l, p));
+                auto expected = r.erase(at(r, p));
+                LOCKSTEP_CHECK(std::distance(l.begin(), it) == std::distance(r.begin(), expected));
+                break;
+            }
+            case 2: {
+                auto p = position(true), q = position(true);
+                if(p > q) std::swap(p, q);
+                l.erase(at(l, p), at(l, q));
+                r.erase(at(r, p), at(r, q));
+                break;
+            }
+            case 3: {
+                auto p = position(true);
+                l.splice(at(l, p), other);
+                r.splice(at(r, p), other_ref);
+                break;
+            }
+            case 4: {
+                if(other_ref.empty()) break;
+                auto p = position(true);
+                auto q = source.below(other_ref.size());
+                l.splice(at(l, p), other, at(other, q));
+                r.splice(at(r, p), other_ref, at(other_ref, q));
+                break;
+            }
+            case 5: {
+                auto p = position(true);
+                auto f = source.below(other_ref.size() + 1), e = source.below(other_ref.size() + 1);
+                if(f > e) std::swap(f, e);
+                l.splice(at(l, p), other, at(other, f), at(other, e));
+                r.splice(at(r, p), other_ref, at(other_ref, f), at(other_ref, e));
+                break;
+            }
+            case 6: {
+                /* splice inside one list, pos outside [first, last) */
+                auto f = position(true), e = position(true);
+                if(f > e) std::swap(f, e);
+                auto p = source.below(f + r.size() - e + 1);
+                if(p >= f) p += e - f;
+                l.splice(at(l, p), l, at(l, f), at(l, e));
+                r.splice(at(r, p), r, at(r, f), at(r, e));
+                break;
+            }
+            case 7: {
+                auto pred = [&](const T& e){ return e == value; };
+                LOCKSTEP_CHECK(l.remove_if(pred) == r.remove_if(pred));
+                break;
+            }
+            case 8: {
+                LOCKSTEP_CHECK(l.unique() == r.unique());
+                break;
+            }
+            case 9: {
+                auto n = source.below(20);
+                l.resize(n);
+                r.resize(n);
+                break;
+            }
+            case 10: {
+                auto n = source.below(20);
+                l.resize(n, value);
+                r.resize(n, value);
+                break;
+            }
+            case 11: {
+                auto n = source.below(10);
+                l.assign(n, value);
+                r.assign(n, value);
+                break;
+            }
+            case 12: {
+                std::vector<T> values(source.below(6), value);
+                l.assign(values.begin(), values.end());
+                r.assign(values.begin(), values.end());
+                break;
+            }
+            case 13: {
+                auto p = position(true);
+                std::vector<T> values(source.below(6), value);
+                l.insert(at(l, p), values.begin(), values.end());
+                r.insert(at(r, p), values.begin(), values.end());
+                break;
+            }
+            case 14: {
+                l.reverse();
+                r.reverse();
+                break;
+            }
+            case 15: {
+                l.sort();
+                r.sort();
+                break;
+            }
+            case 16: {
+                l.sort(std::greater<>());
+                r.sort(std::greater<>());
+                break;
+            }
+            case 17: {
+                l.swap(other);
+                r.swap(other_ref);
+                break;
+            }
+            case 18: {
+                LinkedList<T> moved(std::move(l));
+                l = std::move(other);
+                other = moved;
+                std::list<T> moved_ref(std::move(r));
+                r = std::move(other_ref);
+                other_ref = moved_ref;
+                break;
+            }
+            case 19: {
+                /* the argument aliases an element of the list */
+                if(r.empty()) break;
+                LOCKSTEP_CHECK(l.remove(l.front()) == r.remove(r.front()));
+                break;
+            }
+            case 20: {
+                l.sort();
+                other.sort();
+                r.sort();
+                other_ref.sort();
+                l.merge(other);
+                r.merge(other_ref);
+                break;
+            }
+            case 21: {
+                l.push_front(value);
+                r.push_front(value);
+                l.pop_back();
+                r.pop_back();
+                break;
+            }
+            case 22: {
+                l = other;
+                r = other_ref;
+                break;
+            }
+            case 23: {
+                /* emplace from an lvalue that lives in the list */
+                if(r.empty()) break;
+                auto p = position(false);
+                l.emplace_back(*at(l, p));
+                r.emplace_back(*at(r, p));
+                break;
+            }
+            case 24: {
+                auto f = position(true), e = position(true);
+                if(f > e) std::swap(f, e);
+                l.reverse(at(l, f), at(l, e));
+                std::reverse(at(r, f), at(r, e));
+                break;
+            }
+            default: {
+                std::size_t s[3] = {position(true), position(true), position(true)};
+                std::sort(std::begin(s), std::end(s));
+                auto it = l.rotate(at(l, s[0]), at(l, s[1]), at(l, s[2]));
+                auto expected = std::rotate(at(r, s[0]), at(r, s[1]), at(r, s[2]));
+                LOCKSTEP_CHECK(std::distance(l.begin(), it) == std::distance(r.begin(), expected));
+                break;
+            }
+        }
+
+        for(std::size_t k=0; k<2; ++k){
+            LOCKSTEP_CHECK(lists[k].debug_check());
+            LOCKSTEP_CHECK(lists[k].size() == refs[k].size());
+            LOCKSTEP_CHECK(std::equal(lists[k].begin(), lists[k].end(), refs[k].begin(), refs[k].end()));
+            LOCKSTEP_CHECK(std::equal(lists[k].rbegin(), lists[k].rend(), refs[k].rbegin(), refs[k].rend()));
+        }
+    }
+}
+
+
+/* the element type is taken from the first byte */
+inline void lockstep_run(const std::uint8_t* data, std::size_t size){
+
+    if(size == 0){
+        return;
+    }
+
+    ByteSource source(data + 1, size - 1);
+    if(data[0] % 2){
+        lockstep_run<std::string>(source);
+    }else{
+        lockstep_run<int>(source);
+    }
+}
+
+
+#endif //LINKEDLIST_TESTS_LIST_LOCKSTEP_H
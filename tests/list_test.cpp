@@ -0,0 +1,146 @@
+// LinkedList against std::list: the lockstep driver on random inputs, plus
+// checks that sort, remove, reverse and rotate keep elements in their nodes
+// and that sort loses nothing when the comparator throws.
+// g++ -std=c++20 -g -fsanitize=address,undefined -I.. list_test.cpp -o list_test && ./list_test
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "list_lockstep.h"
+
+
+/* iterators taken before sort and remove_if still point at the same elements */
+void test_identity(){
+
+    LinkedList<std::pair<int, int>> l;
+    for(int i=0; i<100; ++i){
+        l.push_back({i % 7, i});
+    }
+
+    std::vector<LinkedList<std::pair<int, int>>::iterator> its;
+    for(auto it = l.begin(); it != l.end(); ++it){
+        its.push_back(it);
+    }
+
+    l.sort([](auto& a, auto& b){ return a.first < b.first; });
+    for(std::size_t i=0; i<its.size(); ++i){
+        assert(its[i]->second == int(i));
+    }
+
+    /* stable */
+    for(auto it = l.begin(); std::next(it) != l.end(); ++it){
+        auto next = std::next(it);
+        assert(it->first < next->first || it->second < next->second);
+    }
+
+    l.remove_if([](auto& e){ return e.second % 2; });
+    for(std::size_t i=0; i<its.size(); i+=2){
+        assert(its[i]->second == int(i));
+    }
+    assert(l.debug_check());
+}
+
+
+/* sub-range reverse and rotate against the std algorithms on a vector */
+void test_reverse_rotate(){
+
+    std::mt19937 rng(7);
+
+    for(int round=0; round<20000; ++round){
+        std::size_t n = rng() % 12;
+        LinkedList<int> l;
+        std::vector<int> v;
+        for(std::size_t i=0; i<n; ++i){
+            l.push_back(int(i));
+            v.push_back(int(i));
+        }
+
+        std::vector<LinkedList<int>::iterator> its;
+        for(auto it = l.begin(); it != l.end(); ++it){
+            its.push_back(it);
+        }
+
+        std::size_t s[3] = {rng() % (n + 1), rng() % (n + 1), rng() % (n + 1)};
+        std::sort(std::begin(s), std::end(s));
+        auto at = [&](std::size_t p){ return std::next(l.cbegin(), std::ptrdiff_t(p)); };
+
+        if(rng() % 2){
+            l.reverse(at(s[0]), at(s[2]));
+            std::reverse(v.begin() + s[0], v.begin() + s[2]);
+        }else{
+            auto ret = l.rotate(at(s[0]), at(s[1]), at(s[2]));
+            auto expected = std::rotate(v.begin() + s[0], v.begin() + s[1], v.begin() + s[2]);
+            assert(std::distance(l.begin(), ret) == expected - v.begin());
+        }
+
+        assert(l.debug_check());
+        assert(std::equal(l.begin(), l.end(), v.begin(), v.end()));
+        for(std::size_t i=0; i<n; ++i){
+            assert(*its[i] == int(i));
+        }
+    }
+}
+
+
+/* a throwing comparator may leave any order, but every element stays in the list */
+void test_sort_throws(){
+
+    struct Thrown {};
+
+    for(int limit=1; limit<700; limit+=7){
+        LinkedList<int> l;
+        std::vector<int> values;
+        std::mt19937 rng(limit);
+        for(int i=0; i<100; ++i){
+            values.push_back(int(rng() % 50));
+            l.push_back(values.back());
+        }
+
+        int calls = 0;
+        bool thrown = false;
+        try{
+            l.sort([&](int a, int b){
+                if(++calls == limit){
+                    throw Thrown();
+                }
+                return a < b;
+            });
+        }catch(const Thrown&){
+            thrown = true;
+        }
+
+        assert(l.debug_check() && l.size() == 100);
+        std::vector<int> after(l.begin(), l.end());
+        if(!thrown){
+            assert(std::is_sorted(after.begin(), after.end()));
+        }
+        std::sort(after.begin(), after.end());
+        std::sort(values.begin(), values.end());
+        assert(after == values);
+    }
+}
+
+
+int main(int argc, char* argv[]){
+
+    test_identity();
+    test_reverse_rotate();
+    test_sort_throws();
+
+    unsigned rounds = argc > 1 ? unsigned(std::atoi(argv[1])) : 3000;
+    std::mt19937 rng(42);
+    for(unsigned round=0; round<rounds; ++round){
+        std::vector<std::uint8_t> input(rng() % 2000);
+        for(auto &byte : input){
+            byte = std::uint8_t(rng());
+        }
+        lockstep_run(input.data(), input.size());
+    }
+
+    std::cout << "list_test ok" << std::endl;
+    return 0;
+}
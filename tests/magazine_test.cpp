@@ -0,0 +1,188 @@
+// MagazineAllocator under cross-thread use, thread exit and thread_local lists.
+// g++ -std=c++20 -g -fsanitize=address,undefined -pthread -I.. magazine_test.cpp -o magazine_test && ./magazine_test
+// g++ -std=c++20 -g -fsanitize=thread -pthread -I.. magazine_test.cpp -o magazine_test && ./magazine_test
+
+#include <cassert>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../LinkedList.h"
+#include "../MagazineAllocator.h"
+
+
+using IntList = LinkedList<int, MagazineAllocator<int, 8>>;
+
+
+/* the block allocator the list rebinds to, it owns the thread cache IntList uses */
+using NodeAllocator = MagazineAllocator<detail::ListValueNode<int>, 8>;
+
+
+/* Constructed empty, before the thread's cache exists, so it is destroyed
+ * after the cache. Its destructor then allocates and frees with the cache
+ * gone, through MagazineDepot::take_one and single-block puts. */
+struct LateList {
+    IntList list_;
+
+    ~LateList(){
+        assert(NodeAllocator::thread_cache_retired());
+        for(int i=0; i<20; ++i){
+            list_.push_back(i);
+        }
+        list_.erase(list_.begin());
+    }
+};
+
+thread_local LateList late_list;
+
+
+/* single blocks and partial magazines are poured into full ones */
+void test_depot_merges(){
+
+    /* a size class of its own, nothing else touches this depot */
+    using depot_type = detail::MagazineDepot<48, 16, 4>;
+    auto &depot = depot_type::instance();
+
+    std::vector<void*> blocks;
+    for(int i=0; i<2; ++i){
+        auto magazine = depot.take();
+        assert(magazine.count_ == 4);
+        while(magazine.count_ > 0){
+            blocks.push_back(magazine.pop());
+        }
+    }
+
+    for(auto block : blocks){
+        detail::Magazine single;
+        single.push(static_cast<detail::FreeBlock*>(block));
+        depot.put(single);
+    }
+
+    auto first = depot.take();
+    auto second = depot.take();
+    assert(first.count_ == 4 && second.count_ == 4);
+
+    /* 3 + 1 make a full magazine, take_one breaks into it */
+    detail::Magazine three;
+    for(int i=0; i<3; ++i){
+        three.push(first.pop());
+    }
+    depot.put(three);
+    void* one = depot.take_one();
+    auto two = depot.take();
+    assert(two.count_ == 2);
+
+    /* everything goes back, two partials of 2 fill one magazine */
+    detail::Magazine rest;
+    rest.push(static_cast<detail::FreeBlock*>(one));
+    rest.push(first.pop());
+    depot.put(rest);
+    depot.put(two);
+    depot.put(second);
+    auto full = depot.take();
+    auto other_full = depot.take();
+    assert(full.count_ == 4 && other_full.count_ == 4);
+    depot.put(full);
+    depot.put(other_full);
+}
+
+
+void test_same_thread(){
+
+    LinkedList<std::string, MagazineAllocator<std::string, 4>> l;
+    for(int i=0; i<1000; ++i){
+        l.push_back(std::to_string(i));
+    }
+    l.sort();
+    l.reverse();
+    l.remove_if([](const std::string& s){ return s.size() == 2; });
+    assert(l.size() == 910 && l.debug_check());
+
+    auto copy = l;
+    l.clear();
+    assert(copy.size() == 910);
+}
+
+
+/* lists built on one thread are destroyed on another */
+void test_cross_thread(){
+
+    std::mutex mutex;
+    std::vector<std::unique_ptr<IntList>> handed_over;
+
+    std::vector<std::thread> producers;
+    for(int t=0; t<4; ++t){
+        producers.emplace_back([&]{
+            for(int round=0; round<50; ++round){
+                auto l = std::make_unique<IntList>();
+                for(int i=0; i<100; ++i){
+                    l->push_back(i);
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                handed_over.push_back(std::move(l));
+            }
+        });
+    }
+    for(auto &thread : producers){
+        thread.join();
+    }
+
+    /* short-lived consumers, each retires its cache right after freeing */
+    std::vector<std::thread> consumers;
+    for(int t=0; t<8; ++t){
+        consumers.emplace_back([&]{
+            for(;;){
+                std::unique_ptr<IntList> l;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if(handed_over.empty()){
+                        return;
+                    }
+                    l = std::move(handed_over.back());
+                    handed_over.pop_back();
+                }
+                long sum = 0;
+                for(auto i : *l){
+                    sum += i;
+                }
+                assert(sum == 4950);
+            }
+        });
+    }
+    for(auto &thread : consumers){
+        thread.join();
+    }
+}
+
+
+/* late_list outlives the thread's cache, see LateList */
+void test_thread_local(){
+
+    for(int t=0; t<16; ++t){
+        std::thread([]{
+            assert(late_list.list_.empty());
+            assert(!NodeAllocator::thread_cache_retired());
+
+            /* creates the cache, after late_list */
+            IntList warm{1, 2, 3};
+
+            late_list.list_.assign({1, 2, 3, 4});
+            assert(!NodeAllocator::thread_cache_retired());
+        }).join();
+    }
+}
+
+
+int main(){
+
+    test_depot_merges();
+    test_same_thread();
+    test_cross_thread();
+    test_thread_local();
+
+    std::cout << "magazine_test ok" << std::endl;
+    return 0;
+}
@@ -0,0 +1,78 @@
+// Iterator concepts, range constructor and range inserts.
+// g++ -std=c++20 -g -fsanitize=address,undefined -I.. ranges_test.cpp -o ranges_test && ./ranges_test
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <ranges>
+#include <string>
+#include <vector>
+
+#include "../LinkedList.h"
+
+using namespace std;
+
+
+static_assert(bidirectional_iterator<LinkedList<int>::iterator>);
+static_assert(bidirectional_iterator<LinkedList<int>::const_iterator>);
+static_assert(ranges::bidirectional_range<LinkedList<int>>);
+static_assert(ranges::bidirectional_range<const LinkedList<int>>);
+static_assert(ranges::sized_range<LinkedList<int>>);
+static_assert(ranges::common_range<LinkedList<int>>);
+
+/* only ranges whose elements convert to T are accepted */
+template<typename R>
+concept Appendable = requires(LinkedList<int> l, R r){ l.append_range(r); };
+
+static_assert(Appendable<vector<int>>);
+static_assert(!Appendable<vector<string>>);
+static_assert(!is_constructible_v<LinkedList<int>, linkedlist::from_range_t, vector<string>>);
+
+
+struct Thrower {
+    int value_;
+    Thrower(int value): value_(value){
+        if(value == 3){
+            throw value;
+        }
+    }
+};
+
+
+int main(){
+
+    vector<int> v{1, 2, 3, 4, 5};
+
+    /* lazy views go straight into the list, no intermediate container */
+    LinkedList<int> list(linkedlist::from_range, v | views::filter([](int x){ return x % 2 == 1; }));
+    assert(ranges::equal(list, vector<int>{1, 3, 5}));
+
+    list.append_range(views::iota(10, 13));
+    list.prepend_range(v | views::take(2));
+    list.insert_range(next(list.cbegin()), vector<int>{7});
+    assert(ranges::equal(list, vector<int>{1, 7, 2, 1, 3, 5, 10, 11, 12}));
+
+    auto doubled = list | views::reverse | views::transform([](int x){ return x * 2; });
+    assert(ranges::equal(doubled, vector<int>{24, 22, 20, 10, 6, 2, 4, 14, 2}));
+    assert(ranges::find(list, 12) != list.end());
+
+    /* count/value, not the iterator pair overload */
+    LinkedList<int> filled(3, 5);
+    assert(ranges::equal(filled, vector<int>{5, 5, 5}));
+
+    /* a throwing element leaves the list as it was */
+    LinkedList<Thrower> throwers{Thrower(1)};
+    bool caught = false;
+    try{
+        throwers.append_range(views::iota(0, 5));
+    }catch(int){
+        caught = true;
+    }
+    assert(caught && throwers.size() == 1 && throwers.front().value_ == 1);
+
+    LinkedList<int>::iterator empty_it;
+    assert(empty_it == LinkedList<int>::iterator());
+
+    cout << "ranges_test ok" << endl;
+    return 0;
+}
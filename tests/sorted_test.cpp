@@ -0,0 +1,207 @@
+// SortedLinkedList against std::multiset, including the stability of equal keys.
+// g++ -std=c++20 -g -fsanitize=address,undefined -I.. sorted_test.cpp -o sorted_test && ./sorted_test
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../SortedLinkedList.h"
+
+
+/* second is a serial number, only first takes part in the order */
+using Item = std::pair<int, int>;
+
+struct ByKey {
+    bool operator ()(const Item& a, const Item& b) const noexcept{
+        return a.first < b.first;
+    }
+};
+
+using Sorted = SortedLinkedList<Item, ByKey>;
+using Reference = std::multiset<Item, ByKey>;
+
+
+/* multiset also keeps equal keys in insertion order */
+void check(const Sorted& s, const Reference& ref){
+
+    assert(s.size() == ref.size());
+    assert(std::equal(s.begin(), s.end(), ref.begin(), ref.end()));
+}
+
+
+void test_random(std::uint64_t seed){
+
+    std::mt19937_64 rng(seed);
+    auto key = [&]{ return int(rng() % 200); };
+    int serial = 0;
+
+    Sorted s;
+    Reference ref;
+
+    for(int step=0; step<3000; ++step){
+        switch(rng() % 8){
+            case 0: case 1: case 2: {
+                Item item{key(), serial++};
+                auto it = s.insert(item);
+                assert(*it == item);
+                ref.insert(item);
+                break;
+            }
+            case 3: {
+                Item item{key(), 0};
+                assert(s.erase(item) == ref.erase(item));
+                break;
+            }
+            case 4: {
+                Item item{key(), 0};
+                auto it = s.lower_bound(item);
+                auto expected = ref.lower_bound(item);
+                assert(std::distance(s.begin(), it) == std::distance(ref.begin(), expected));
+                assert(std::distance(s.begin(), s.upper_bound(item)) == std::distance(ref.begin(), ref.upper_bound(item)));
+                assert(s.contains(item) == ref.contains(item));
+                if(it != s.end() && rng() % 2){
+                    s.erase(it);
+                    ref.erase(expected);
+                }
+                break;
+            }
+            case 5: {
+                /* a small other takes the search path, a large one the run splice path */
+                Sorted other;
+                std::size_t count = rng() % 2 ? rng() % 4 : ref.size() / 8 + rng() % 100;
+                for(std::size_t i=0; i<count; ++i){
+                    Item item{key(), serial++};
+                    other.insert(item);
+                    ref.insert(item);
+                }
+                s.merge(other);
+                assert(other.empty());
+                break;
+            }
+            case 6: {
+                Sorted other;
+                Reference theirs;
+                for(int i=0, n=int(rng() % 60); i<n; ++i){
+                    Item item{key(), serial++};
+                    other.insert(item);
+                    theirs.insert(item);
+                }
+                Reference expected;
+                switch(rng() % 3){
+                    case 0: {
+                        s.set_intersection(other);
+                        for(auto &i : ref){
+                            if(theirs.contains(i)) expected.insert(i);
+                        }
+                        break;
+                    }
+                    case 1: {
+                        s.set_difference(other);
+                        for(auto &i : ref){
+                            if(!theirs.contains(i)) expected.insert(i);
+                        }
+                        break;
+                    }
+                    default: {
+                        Reference left;
+                        expected = ref;
+                        for(auto &i : theirs){
+                            if(expected.contains(i)) left.insert(i);
+                            else expected.insert(i);
+                        }
+                        s.set_union(other);
+                        check(other, left);
+                        break;
+                    }
+                }
+                ref = std::move(expected);
+                break;
+            }
+            default: {
+                if(rng() % 50 == 0){
+                    Sorted copy(s);
+                    s.clear();
+                    ref.clear();
+                    check(copy, Reference(copy.begin(), copy.end()));
+                    s = copy;
+                    ref.insert(copy.begin(), copy.end());
+                }
+                break;
+            }
+        }
+        check(s, ref);
+    }
+}
+
+
+/* the argument refers to an element of the list */
+void test_erase_aliased(){
+
+    SortedLinkedList<std::string> s{"b", "a", "b", "c", "b"};
+    assert(s.erase(s.front()) == 1);
+    assert(s.erase(*s.lower_bound("b")) == 3);
+    assert(s.erase(s.back()) == 1);
+    assert(s.empty());
+}
+
+
+void test_merge_runs(){
+
+    SortedLinkedList<int> a, b;
+    for(int i=0; i<10000; ++i){
+        a.insert(i / 100 % 2 ? i : i + 100000);
+        b.insert(i);
+    }
+    a.merge(b);
+    assert(b.empty() && a.size() == 20000);
+    assert(std::is_sorted(a.begin(), a.end()));
+    for(int i=0; i<10000; ++i){
+        assert(a.contains(i));
+    }
+}
+
+
+/* erase cost must not grow with the number of equal keys */
+void test_many_duplicates(){
+
+    SortedLinkedList<Item, ByKey> s;
+    for(int i=0; i<20000; ++i){
+        s.insert({i % 2, i});
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for(int i=0; i<20000; ++i){
+        assert(s.front().first == (i < 10000 ? 0 : 1));
+        s.erase(s.begin());
+    }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    /* scanning the equal keys on every erase took about a second */
+    std::cout << "  drained 20000 equal keys in " << ms << " ms" << std::endl;
+    assert(ms < 250);
+
+    for(int i=0; i<5000; ++i){
+        s.insert({7, i});
+    }
+    assert(s.erase(Item{7, 0}) == 5000 && s.empty());
+}
+
+
+int main(){
+
+    for(std::uint64_t seed=1; seed<=20; ++seed){
+        test_random(seed);
+    }
+    test_erase_aliased();
+    test_merge_runs();
+    test_many_duplicates();
+
+    std::cout << "sorted_test ok" << std::endl;
+    return 0;
+}